@@ -11,10 +11,13 @@
 
 #include "ty/ty-core-config.h"
 
+#include <string.h>
+
 #include "ty/common/code_utils.hpp"
-// #include "ty/common/const_cast.hpp"
+#include "ty/common/const_cast.hpp"
 #include "ty/common/error.hpp"
 #include "ty/common/locator.hpp"
+#include "ty/common/new.hpp"
 #include "ty/common/numeric_limits.hpp"
 #include "ty/common/type_traits.hpp"
 
@@ -75,6 +78,10 @@ template <typename Type, uint16_t kArrayLength> inline const Type *GetArrayEnd(c
 /**
  * Represents an array of elements with a fixed max size.
  *
+ * All `kMaxSize` elements are constructed along with the array. Adding an element assigns (copies or moves) to an
+ * existing element, except for `EmplaceBack()` which constructs the element in place. When `Type` is trivially
+ * copyable, elements are copied and moved in bulk using `memcpy()`/`memmove()` instead of one by one.
+ *
  * @tparam Type        The array element type.
  * @tparam kMaxSize    Specifies the max array size (maximum number of elements in the array).
  * @tparam SizeType    The type to be used for array size, length, and index. If not specified, a default `uint` type
@@ -109,11 +116,29 @@ public:
      * Initializes the array by copying elements from another array.
      *
      * The method uses assignment `=` operator on `Type` to copy each element from @p aOtherArray into the elements of
-     * the array.
+     * the array (or `memcpy()` if `Type` is trivially copyable).
      *
      * @param[in] aOtherArray  Another array to copy from.
      */
-    Array(const Array &aOtherArray) { *this = aOtherArray; }
+    Array(const Array &aOtherArray)
+        : mLength(0)
+    {
+        *this = aOtherArray;
+    }
+
+    /**
+     * Initializes the array by moving elements from another array.
+     *
+     * The method uses move assignment `=` operator on `Type` to move each element from @p aOtherArray into the
+     * elements of the array (or `memcpy()` if `Type` is trivially copyable). @p aOtherArray is cleared.
+     *
+     * @param[in] aOtherArray  Another array to move from.
+     */
+    Array(Array &&aOtherArray)
+        : mLength(0)
+    {
+        *this = Move(aOtherArray);
+    }
 
     /**
      * Initializes the array as empty and initializes its elements by calling `Init(Instance &)`
@@ -272,6 +297,99 @@ public:
      */
     Error PushBack(const Type &aEntry) { return IsFull() ? kErrorNoBufs : (mElements[mLength++] = aEntry, kErrorNone); }
 
+    /**
+     * Appends a new entry to the end of the array by moving it.
+     *
+     * The method uses move assignment `=` operator on `Type` to move @p aEntry into the added array element.
+     *
+     * @param[in] aEntry     The new entry to push back.
+     *
+     * @retval kErrorNone    Successfully pushed back @p aEntry to the end of the array.
+     * @retval kErrorNoBufs  Could not append the new element since array is full.
+     */
+    Error PushBack(Type &&aEntry)
+    {
+        return IsFull() ? kErrorNoBufs : (mElements[mLength++] = Move(aEntry), kErrorNone);
+    }
+
+    /**
+     * Appends a new entry to the end of the array by constructing it in place from given arguments.
+     *
+     * The existing (unused) element at the end of the array is destroyed and a new one is constructed in its place
+     * using the `Type` constructor matching @p aArgs, so no temporary `Type` object is created and copied.
+     *
+     * @tparam Args   The constructor argument types.
+     *
+     * @param[in] aArgs   The arguments to pass to the `Type` constructor.
+     *
+     * @returns A pointer to the newly appended element or `nullptr` if array is full.
+     */
+    template <typename... Args> Type *EmplaceBack(Args &&...aArgs)
+    {
+        Type *element = nullptr;
+
+        VerifyOrExit(!IsFull());
+
+        element = &mElements[mLength++];
+        element->~Type();
+        new (element) Type(Forward<Args>(aArgs)...);
+
+    exit:
+        return element;
+    }
+
+    /**
+     * Inserts a new entry at a given index in the array.
+     *
+     * The elements at and after @p aIndex are moved up by one to make room for the new entry, so the order of the
+     * elements in the array is preserved. The method uses assignment `=` operator on `Type` to copy @p aEntry into the
+     * inserted array element.
+     *
+     * @param[in] aIndex     The index to insert at (MUST be less than or equal to the current length).
+     * @param[in] aEntry     The new entry to insert.
+     *
+     * @retval kErrorNone         Successfully inserted @p aEntry at @p aIndex.
+     * @retval kErrorNoBufs       Could not insert the new element since array is full.
+     * @retval kErrorInvalidArgs  The @p aIndex is larger than the current length.
+     */
+    Error Insert(IndexType aIndex, const Type &aEntry)
+    {
+        Error error = PrepareInsert(aIndex);
+
+        if (error == kErrorNone)
+        {
+            mElements[aIndex] = aEntry;
+        }
+
+        return error;
+    }
+
+    /**
+     * Inserts a new entry at a given index in the array by moving it.
+     *
+     * The elements at and after @p aIndex are moved up by one to make room for the new entry, so the order of the
+     * elements in the array is preserved. The method uses move assignment `=` operator on `Type` to move @p aEntry
+     * into the inserted array element.
+     *
+     * @param[in] aIndex     The index to insert at (MUST be less than or equal to the current length).
+     * @param[in] aEntry     The new entry to insert.
+     *
+     * @retval kErrorNone         Successfully inserted @p aEntry at @p aIndex.
+     * @retval kErrorNoBufs       Could not insert the new element since array is full.
+     * @retval kErrorInvalidArgs  The @p aIndex is larger than the current length.
+     */
+    Error Insert(IndexType aIndex, Type &&aEntry)
+    {
+        Error error = PrepareInsert(aIndex);
+
+        if (error == kErrorNone)
+        {
+            mElements[aIndex] = Move(aEntry);
+        }
+
+        return error;
+    }
+
     /**
      * Appends a new entry to the end of the array.
      *
@@ -308,7 +426,7 @@ public:
      * To remove @p aElement, it is replaced by the last element in array, so the order of items in the array can
      * change after a call to this method.
      *
-     * The method uses assignment `=` operator on `Type` to copy the last element in place of @p aElement.
+     * The method uses move assignment `=` operator on `Type` to move the last element in place of @p aElement.
      */
     void Remove(Type &aElement)
     {
@@ -316,10 +434,34 @@ public:
 
         if (lastElement != &aElement)
         {
-            aElement = *lastElement;
+            aElement = Move(*lastElement);
         }
     }
 
+    /**
+     * Removes the element at a given index from the array, preserving the order of the remaining elements.
+     *
+     * Unlike `Remove()`, the elements after @p aIndex are moved down by one (using move assignment `=` operator on
+     * `Type`, or `memmove()` if `Type` is trivially copyable) to fill the gap.
+     *
+     * @param[in] aIndex   The index of the element to remove.
+     *
+     * @retval kErrorNone         Successfully removed the element at @p aIndex.
+     * @retval kErrorInvalidArgs  The @p aIndex is not less than the current length.
+     */
+    Error RemoveAt(IndexType aIndex)
+    {
+        Error error = kErrorNone;
+
+        VerifyOrExit(aIndex < mLength, error = kErrorInvalidArgs);
+
+        mLength--;
+        ShiftDown(aIndex, TypeTraits::IsTriviallyCopyable<Type>());
+
+    exit:
+        return error;
+    }
+
     /**
      * Finds the first match of a given entry in the array.
      *
@@ -498,17 +640,38 @@ public:
      * Overloads assignment `=` operator to copy elements from another array into the array.
      *
      * The method uses assignment `=` operator on `Type` to copy each element from @p aOtherArray into the elements of
-     * the array.
+     * the array (or a single `memcpy()` if `Type` is trivially copyable).
      *
      * @param[in] aOtherArray  Another array to copy from.
      */
     Array &operator=(const Array &aOtherArray)
     {
-        Clear();
+        if (&aOtherArray != this)
+        {
+            CopyElements(mElements, aOtherArray.mElements, aOtherArray.mLength,
+                         TypeTraits::IsTriviallyCopyable<Type>());
+            mLength = aOtherArray.mLength;
+        }
+
+        return *this;
+    }
 
-        for (const Type &otherElement : aOtherArray)
+    /**
+     * Overloads move assignment `=` operator to move elements from another array into the array.
+     *
+     * The method uses move assignment `=` operator on `Type` to move each element from @p aOtherArray into the
+     * elements of the array (or a single `memcpy()` if `Type` is trivially copyable). @p aOtherArray is cleared.
+     *
+     * @param[in] aOtherArray  Another array to move from.
+     */
+    Array &operator=(Array &&aOtherArray)
+    {
+        if (&aOtherArray != this)
         {
-            IgnoreError(PushBack(otherElement));
+            MoveElements(mElements, aOtherArray.mElements, aOtherArray.mLength,
+                         TypeTraits::IsTriviallyCopyable<Type>());
+            mLength = aOtherArray.mLength;
+            aOtherArray.Clear();
         }
 
         return *this;
@@ -540,6 +703,77 @@ public:
     const Type *end(void) const { return &mElements[mLength]; }
 
 private:
+    Error PrepareInsert(IndexType aIndex)
+    {
+        Error error = kErrorNone;
+
+        VerifyOrExit(aIndex <= mLength, error = kErrorInvalidArgs);
+        VerifyOrExit(!IsFull(), error = kErrorNoBufs);
+
+        ShiftUp(aIndex, TypeTraits::IsTriviallyCopyable<Type>());
+        mLength++;
+
+    exit:
+        return error;
+    }
+
+    // The following helpers are overloaded on `TrueValue` and
+    // `FalseValue` and are called with `IsTriviallyCopyable<Type>`
+    // (which derives from one of them) to select the `memcpy()`
+    // based or the element-wise implementation at compile time.
+
+    static void CopyElements(Type *aDst, const Type *aSrc, IndexType aLength, TypeTraits::TrueValue)
+    {
+        memcpy(aDst, aSrc, aLength * sizeof(Type));
+    }
+
+    static void CopyElements(Type *aDst, const Type *aSrc, IndexType aLength, TypeTraits::FalseValue)
+    {
+        for (IndexType index = 0; index < aLength; index++)
+        {
+            aDst[index] = aSrc[index];
+        }
+    }
+
+    static void MoveElements(Type *aDst, Type *aSrc, IndexType aLength, TypeTraits::TrueValue)
+    {
+        memcpy(aDst, aSrc, aLength * sizeof(Type));
+    }
+
+    static void MoveElements(Type *aDst, Type *aSrc, IndexType aLength, TypeTraits::FalseValue)
+    {
+        for (IndexType index = 0; index < aLength; index++)
+        {
+            aDst[index] = Move(aSrc[index]);
+        }
+    }
+
+    void ShiftUp(IndexType aIndex, TypeTraits::TrueValue)
+    {
+        memmove(&mElements[aIndex + 1], &mElements[aIndex], (mLength - aIndex) * sizeof(Type));
+    }
+
+    void ShiftUp(IndexType aIndex, TypeTraits::FalseValue)
+    {
+        for (IndexType index = mLength; index > aIndex; index--)
+        {
+            mElements[index] = Move(mElements[index - 1]);
+        }
+    }
+
+    void ShiftDown(IndexType aIndex, TypeTraits::TrueValue)
+    {
+        memmove(&mElements[aIndex], &mElements[aIndex + 1], (mLength - aIndex) * sizeof(Type));
+    }
+
+    void ShiftDown(IndexType aIndex, TypeTraits::FalseValue)
+    {
+        for (IndexType index = aIndex; index < mLength; index++)
+        {
+            mElements[index] = Move(mElements[index + 1]);
+        }
+    }
+
     Type      mElements[kMaxSize];
     IndexType mLength;
 };
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for atomic variables.
+ */
+
+#ifndef TY_ATOMIC_HPP_
+#define TY_ATOMIC_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "ty/common/non_copyable.hpp"
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "Atomic requires the `__atomic` builtins (GCC or Clang)"
+#endif
+
+namespace ty {
+
+/**
+ * Represents the memory ordering of an atomic operation (equivalent to `std::memory_order`).
+ */
+enum MemoryOrder : int
+{
+    kMemoryOrderRelaxed = __ATOMIC_RELAXED, ///< No ordering, only atomicity.
+    kMemoryOrderAcquire = __ATOMIC_ACQUIRE, ///< Later accesses are not reordered before the (load) operation.
+    kMemoryOrderRelease = __ATOMIC_RELEASE, ///< Earlier accesses are not reordered after the (store) operation.
+    kMemoryOrderAcqRel  = __ATOMIC_ACQ_REL, ///< Both acquire and release (read-modify-write operations).
+    kMemoryOrderSeqCst  = __ATOMIC_SEQ_CST, ///< Acquire and release, plus a single total order.
+};
+
+/**
+ * Represents an atomic variable.
+ *
+ * The operations are implemented using the compiler `__atomic` builtins, which are available with both GCC and Clang
+ * on all supported platforms (POSIX, ESP-IDF and Zephyr), and are what `std::atomic` and the Zephyr `atomic_*` API are
+ * built on. On targets without native atomic instructions for the size of `Type`, the compiler calls the `libatomic`
+ * helper functions (provided by the toolchain or the platform).
+ *
+ * @tparam Type  The value type (an integer, enum or pointer type).
+ */
+template <typename Type> class Atomic : private NonCopyable
+{
+public:
+    /**
+     * Initializes the atomic variable with a given value.
+     *
+     * The initialization itself is not atomic.
+     *
+     * @param[in] aValue  The initial value.
+     */
+    explicit Atomic(Type aValue = Type())
+        : mValue(aValue)
+    {
+    }
+
+    /**
+     * Atomically loads the value.
+     *
+     * @param[in] aOrder  The memory order (`kMemoryOrderRelaxed`, `kMemoryOrderAcquire` or `kMemoryOrderSeqCst`).
+     *
+     * @returns The value.
+     */
+    Type Load(MemoryOrder aOrder = kMemoryOrderSeqCst) const { return __atomic_load_n(&mValue, aOrder); }
+
+    /**
+     * Atomically stores a value.
+     *
+     * @param[in] aValue  The value to store.
+     * @param[in] aOrder  The memory order (`kMemoryOrderRelaxed`, `kMemoryOrderRelease` or `kMemoryOrderSeqCst`).
+     */
+    void Store(Type aValue, MemoryOrder aOrder = kMemoryOrderSeqCst) { __atomic_store_n(&mValue, aValue, aOrder); }
+
+    /**
+     * Atomically replaces the value, returning the previous value.
+     *
+     * @param[in] aValue  The new value.
+     * @param[in] aOrder  The memory order.
+     *
+     * @returns The previous value.
+     */
+    Type Exchange(Type aValue, MemoryOrder aOrder = kMemoryOrderSeqCst)
+    {
+        return __atomic_exchange_n(&mValue, aValue, aOrder);
+    }
+
+    /**
+     * Atomically compares the value with an expected value, and if equal replaces it with a desired value.
+     *
+     * The comparison may spuriously fail (weak compare-and-exchange), so it is intended to be used in a loop.
+     *
+     * @param[in,out] aExpected  The expected value. On failure, it is updated to the current value.
+     * @param[in]     aDesired   The value to store if the current value is equal to @p aExpected.
+     * @param[in]     aSuccess   The memory order if the value is replaced.
+     * @param[in]     aFailure   The memory order if the value is not replaced (MUST NOT be stronger than
+     *                           @p aSuccess, nor a release order).
+     *
+     * @retval TRUE   The value was equal to @p aExpected and was replaced with @p aDesired.
+     * @retval FALSE  The value was not replaced (@p aExpected is updated to the current value).
+     */
+    bool CompareExchangeWeak(Type       &aExpected,
+                             Type        aDesired,
+                             MemoryOrder aSuccess = kMemoryOrderSeqCst,
+                             MemoryOrder aFailure = kMemoryOrderSeqCst)
+    {
+        return __atomic_compare_exchange_n(&mValue, &aExpected, aDesired, /* weak */ true, aSuccess, aFailure);
+    }
+
+    /**
+     * Atomically adds to the value, returning the previous value.
+     *
+     * @param[in] aValue  The value to add.
+     * @param[in] aOrder  The memory order.
+     *
+     * @returns The previous value.
+     */
+    Type FetchAdd(Type aValue, MemoryOrder aOrder = kMemoryOrderSeqCst)
+    {
+        return __atomic_fetch_add(&mValue, aValue, aOrder);
+    }
+
+    /**
+     * Atomically subtracts from the value, returning the previous value.
+     *
+     * @param[in] aValue  The value to subtract.
+     * @param[in] aOrder  The memory order.
+     *
+     * @returns The previous value.
+     */
+    Type FetchSub(Type aValue, MemoryOrder aOrder = kMemoryOrderSeqCst)
+    {
+        return __atomic_fetch_sub(&mValue, aValue, aOrder);
+    }
+
+private:
+    Type mValue;
+};
+
+/**
+ * Hints the processor that the caller is busy-waiting (spinning), e.g., on an atomic variable.
+ *
+ * Reduces the power used and the impact on a sibling hardware thread while spinning. Does nothing on processors without
+ * such a hint instruction.
+ */
+inline void CpuRelax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+    __asm__ __volatile__("yield");
+#endif
+}
+
+} // namespace ty
+
+#endif // TY_ATOMIC_HPP_
@@ -8,8 +8,26 @@
 
 #include <stdint.h>
 
+#include "ty/common/num_utils.hpp"
+#include "ty/platform/toolchain.h"
+
 namespace ty {
 
+/**
+ * Implements binary search in sorted tables.
+ *
+ * All methods are templates on the table entry type so that the comparisons are inlined. The searches are branchless
+ * (the only branch is the loop condition, which depends on the table length and not on the data), so they do not
+ * suffer branch mispredictions on random keys.
+ *
+ * The table `Entry` class MUST provide the following method to compare the entry against a given key.
+ *
+ *    int Entry::Compare(const Key &aKey) const;
+ *
+ * The return value indicates the comparison result between @p aKey and the entry (similar to `strcmp()`), i.e.,
+ * zero means perfect match, positive (> 0) indicates @p aKey is larger than entry, and negative indicates @p aKey
+ * is smaller than entry.
+ */
 class BinarySearch
 {
 public:
@@ -18,31 +36,146 @@ public:
      *
      * @note This method requires the array to be sorted, otherwise its behavior is undefined.
      *
+     * @note In the common use of this method as `Find(key, kTable)` where `kTable` is a fixed size array, the
+     * template types/parameters do not need to be explicitly specified and can be inferred from the passed-in argument.
+     *
      * @tparam Key         The type of `Key` to search for.
      * @tparam Entry       The table `Entry` type.
      * @tparam kLength     The array length (number of entries in the array).
      *
-     * The `Entry` class MUST provide the following method to compare the entry against a given key.
+     * @param[in] aKey    The key to search for within the table.
+     * @param[in] aTable  A reference to an array of `kLength` entries of type `Entry`
      *
-     *    int Entry::Compare(const Key &aKey) const;
+     * @returns A pointer to the entry in the table if a match is found, otherwise `nullptr` (no match in table).
+     */
+    template <typename Key, typename Entry, uint16_t kLength>
+    static const Entry *Find(const Key &aKey, const Entry (&aTable)[kLength])
+    {
+        return Find(aKey, &aTable[0], kLength);
+    }
+
+    /**
+     * Performs binary search in a given `constexpr` sorted table array to find an entry matching a given key.
      *
-     * The return value indicates the comparison result between @p aKey and the entry (similar to `strcmp()`), i.e.,
-     * zero means perfect match, positive (> 0) indicates @p aKey is larger than entry, and negative indicates @p aKey
-     * is smaller than entry.
+     * It is verified at compile time (`static_assert`) that @p kTable is sorted, using `IsSorted()`.
      *
-     * @note In the common use of this method as `Find(key, kTable)` where `kTable` is a fixed size array, the
-     * template types/parameters do not need to be explicitly specified and can be inferred from the passed-in argument.
+     * Example of use:
+     *
+     *     static constexpr Entry kTable[] = { ... };
+     *
+     *     const Entry *entry = BinarySearch::Find<kTable>(aKey);
+     *
+     * @tparam kTable      A reference to a `constexpr` array of entries with static storage duration.
+     * @tparam Key         The type of `Key` to search for.
      *
      * @param[in] aKey    The key to search for within the table.
-     * @param[in] aTable  A reference to an array of `kLength` entries of type `Entry`
      *
      * @returns A pointer to the entry in the table if a match is found, otherwise `nullptr` (no match in table).
      */
-    template <typename Key, typename Entry, uint16_t kLength>
-    static const Entry *Find(const Key &aKey, const Entry (&aTable)[kLength])
+    template <const auto &kTable, typename Key> static auto Find(const Key &aKey)
+    {
+        static_assert(IsSorted(kTable), "BinarySearch table is not sorted");
+
+        return Find(aKey, kTable);
+    }
+
+    /**
+     * Performs binary search in a given sorted table to find an entry matching a given key.
+     *
+     * If there are multiple matching entries, the first one is returned.
+     *
+     * @note This method requires the table to be sorted, otherwise its behavior is undefined.
+     *
+     * @tparam Key         The type of `Key` to search for.
+     * @tparam Entry       The table `Entry` type.
+     *
+     * @param[in] aKey     The key to search for within the table.
+     * @param[in] aTable   A pointer to the first entry in the table.
+     * @param[in] aLength  The number of entries in the table.
+     *
+     * @returns A pointer to the entry in the table if a match is found, otherwise `nullptr` (no match in table).
+     */
+    template <typename Key, typename Entry>
+    static const Entry *Find(const Key &aKey, const Entry *aTable, uint16_t aLength)
+    {
+        uint16_t index = LowerBound(aKey, aTable, aLength);
+
+        return ((index < aLength) && (aTable[index].Compare(aKey) == 0)) ? &aTable[index] : nullptr;
+    }
+
+    /**
+     * Finds the index of the first entry in a given sorted table which is not smaller than a given key.
+     *
+     * @tparam Key         The type of `Key` to search for.
+     * @tparam Entry       The table `Entry` type.
+     *
+     * @param[in] aKey     The key to search for within the table.
+     * @param[in] aTable   A pointer to the first entry in the table.
+     * @param[in] aLength  The number of entries in the table.
+     *
+     * @returns The index of the first entry not smaller than @p aKey, or @p aLength if there is none.
+     */
+    template <typename Key, typename Entry>
+    static uint16_t LowerBound(const Key &aKey, const Entry *aTable, uint16_t aLength)
+    {
+        return PartitionPoint(aTable, aLength, [&aKey](const Entry &aEntry) { return aEntry.Compare(aKey) <= 0; });
+    }
+
+    /**
+     * Finds the index of the first entry in a given sorted table which is larger than a given key.
+     *
+     * @tparam Key         The type of `Key` to search for.
+     * @tparam Entry       The table `Entry` type.
+     *
+     * @param[in] aKey     The key to search for within the table.
+     * @param[in] aTable   A pointer to the first entry in the table.
+     * @param[in] aLength  The number of entries in the table.
+     *
+     * @returns The index of the first entry larger than @p aKey, or @p aLength if there is none.
+     */
+    template <typename Key, typename Entry>
+    static uint16_t UpperBound(const Key &aKey, const Entry *aTable, uint16_t aLength)
     {
-        return static_cast<const Entry *>(
-            Find(&aKey, &aTable[0], kLength, sizeof(aTable[0]), BinarySearch::Compare<Key, Entry>));
+        return PartitionPoint(aTable, aLength, [&aKey](const Entry &aEntry) { return aEntry.Compare(aKey) < 0; });
+    }
+
+    /**
+     * Finds the partition point in a given table partitioned by a predicate.
+     *
+     * The table MUST be partitioned by @p aIsAfter, i.e., @p aIsAfter returns FALSE for all entries before the
+     * partition point and TRUE for the entry at the partition point and all entries after it.
+     *
+     * @tparam Entry       The table `Entry` type.
+     * @tparam Predicate   The predicate type, a callable as `bool aIsAfter(const Entry &aEntry)`.
+     *
+     * @param[in] aTable    A pointer to the first entry in the table.
+     * @param[in] aLength   The number of entries in the table.
+     * @param[in] aIsAfter  The predicate.
+     *
+     * @returns The index of the first entry for which @p aIsAfter is TRUE, or @p aLength if there is none.
+     */
+    template <typename Entry, typename Predicate>
+    static uint16_t PartitionPoint(const Entry *aTable, uint16_t aLength, const Predicate &aIsAfter)
+    {
+        // The partition point is always within `[first, first + length]`.
+        // Each step checks the middle entry, halves `length` and
+        // moves `first` past the middle entry if it is before the
+        // partition point. The move is computed arithmetically (by
+        // multiplying with the predicate result) instead of by a
+        // data-dependent branch.
+
+        const Entry *first  = aTable;
+        uint16_t     length = aLength;
+
+        while (length > 0)
+        {
+            uint16_t half = length / 2;
+
+            first += (length - half) * static_cast<uint16_t>(!aIsAfter(first[half]));
+            length = half;
+        }
+
+        return static_cast<uint16_t>(first - aTable);
     }
 
     /**
@@ -70,24 +203,117 @@ public:
         return IsSorted(&aTable[0], kLength);
     }
 
-private:
-    typedef int (&Comparator)(const void *aKey, const void *aEntry);
+    /**
+     * Represents a `constexpr` copy of a sorted table in Eytzinger (breadth-first) layout.
+     *
+     * The entries are stored in the order they are visited by a breadth-first walk of the implicit binary search tree
+     * over the sorted table: the root (the middle entry) first, then its two children, then their four children, and
+     * so on. The first levels of the tree, visited by every search, are therefore packed together at the start of the
+     * array and stay in cache, and the children of an entry are next to each other, so the entries visited a few steps
+     * ahead can be prefetched. This makes searches in large tables considerably faster than binary search in sorted
+     * order, at the cost of no longer being able to iterate the entries in order.
+     *
+     * Example of use:
+     *
+     *     static constexpr Entry                   kTable[] = { ... };
+     *     static constexpr BinarySearch::Eytzinger kEytzingerTable(kTable);
+     *
+     *     const Entry *entry = kEytzingerTable.Find(aKey);
+     *
+     * @tparam Entry       The table entry type (MUST be default constructible in a `constexpr` context).
+     * @tparam kLength     The table length (number of entries).
+     */
+    template <typename Entry, uint16_t kLength> class Eytzinger
+    {
+    public:
+        /**
+         * Initializes the Eytzinger table from a given sorted table.
+         *
+         * @param[in] aTable  A reference to the sorted array of `kLength` entries.
+         */
+        explicit constexpr Eytzinger(const Entry (&aTable)[kLength])
+            : mEntries()
+        {
+            uint16_t index = 0;
+
+            Build(aTable, index, 1);
+        }
+
+        /**
+         * Searches the table to find an entry matching a given key.
+         *
+         * If there are multiple matching entries, the first one (in the sorted order) is returned.
+         *
+         * @tparam Key   The type of `Key` to search for.
+         *
+         * @param[in] aKey  The key to search for within the table.
+         *
+         * @returns A pointer to the entry in the table if a match is found, otherwise `nullptr` (no match in table).
+         */
+        template <typename Key> const Entry *Find(const Key &aKey) const
+        {
+            // Walks down the tree, going to the right child when the
+            // key is larger than the entry. The node reached after
+            // the last left turn (which is found by dropping the
+            // trailing right turns, the one bits, and the last left
+            // turn from `node`) is the first entry not smaller than
+            // the key.
+
+            uint32_t node = 1;
+
+            while (node <= kLength)
+            {
+                if constexpr (kLength >= kMinLengthToPrefetch)
+                {
+                    uint32_t prefetchNode = node * kPrefetchDistance;
+
+                    TY_TOOL_PREFETCH(&mEntries[(prefetchNode <= kLength) ? prefetchNode : 0]);
+                }
 
+                node = 2 * node + ((mEntries[node].Compare(aKey) > 0) ? 1 : 0);
+            }
+
+            node >>= CountTrailingZeros(~node) + 1;
+
+            return ((node != 0) && (mEntries[node].Compare(aKey) == 0)) ? &mEntries[node] : nullptr;
+        }
+
+    private:
+        // Prefetches the first of the (sixteen) descendants four
+        // levels below the current node, which are contiguous.
+        static constexpr uint32_t kPrefetchDistance    = 16;
+        static constexpr uint16_t kMinLengthToPrefetch = 64;
+
+        constexpr void Build(const Entry (&aTable)[kLength], uint16_t &aIndex, uint32_t aNode)
+        {
+            // In-order walk of the tree, so the nodes are assigned
+            // the sorted entries in order.
+
+            if (aNode <= kLength)
+            {
+                Build(aTable, aIndex, 2 * aNode);
+                mEntries[aNode] = aTable[aIndex++];
+                Build(aTable, aIndex, 2 * aNode + 1);
+            }
+        }
+
+        // The tree is one-based (`mEntries[0]` is unused) so that the
+        // children of node `n` are `2n` and `2n + 1`.
+        Entry mEntries[kLength + 1];
+    };
+
+private:
     template <typename Entry> static constexpr bool IsSorted(const Entry *aTable, uint16_t aLength)
     {
-        return (aLength <= 1) ? true : Entry::AreInOrder(aTable[0], aTable[1]) && IsSorted(aTable + 1, aLength - 1);
-    }
+        bool isSorted = true;
 
-    template <typename Key, typename Entry> static int Compare(const void *aKey, const void *aEntry)
-    {
-        return static_cast<const Entry *>(aEntry)->Compare(*static_cast<const Key *>(aKey));
-    }
+        for (uint16_t index = 1; isSorted && (index < aLength); index++)
+        {
+            isSorted = Entry::AreInOrder(aTable[index - 1], aTable[index]);
+        }
 
-    static const void *Find(const void *aKey,
-                            const void *aTable,
-                            uint16_t    aLength,
-                            uint16_t    aEntrySize,
-                            Comparator  aComparator);
+        return isSorted;
+    }
 };
 
 } // namespace ty
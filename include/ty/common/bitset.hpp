@@ -0,0 +1,422 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for a fixed-size bit set.
+ */
+
+#ifndef BITSET_HPP_
+#define BITSET_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/num_utils.hpp"
+#include "ty/common/type_traits.hpp"
+
+namespace ty {
+
+/**
+ * Represents a fixed-size set of bits (e.g., a subscriber mask, a channel mask or a free-slot map).
+ *
+ * The bits are stored in machine words (64-bit words on 64-bit targets, 32-bit words otherwise), so counting, searching
+ * and bulk operations process a word at a time, and searching and iterating use the bit-scan instructions of the
+ * processor (see `CountTrailingZeros()`) to skip the `0` bits.
+ *
+ * The bits beyond `kNumBits` in the last word are always kept as zero.
+ *
+ * @tparam kNumBits  The number of bits in the set.
+ */
+template <uint16_t kNumBits> class Bitset
+{
+    static_assert(kNumBits > 0, "Bitset `kNumBits` cannot be zero");
+
+    typedef typename TypeTraits::Conditional<(sizeof(void *) >= sizeof(uint64_t)), uint64_t, uint32_t>::Type Word;
+
+    static constexpr uint16_t kBitsPerWord = sizeof(Word) * 8;
+    static constexpr uint16_t kNumWords    = (kNumBits + kBitsPerWord - 1) / kBitsPerWord;
+    static constexpr Word     kAllOnes     = ~static_cast<Word>(0);
+    static constexpr Word     kLastWordMask =
+        ((kNumBits % kBitsPerWord) == 0) ? kAllOnes : ((static_cast<Word>(1) << (kNumBits % kBitsPerWord)) - 1);
+
+public:
+    static constexpr uint16_t kNotFound = kNumBits; ///< Index returned by the `Find` methods when no bit is found.
+
+    /**
+     * Represents an iterator over the indices of the `1` bits in a `Bitset`, in increasing order.
+     *
+     * Clearing bits while iterating is allowed, but a bit set (or cleared) in the word of the current bit or in a
+     * previous word is not reflected in the iteration.
+     */
+    class Iterator
+    {
+        friend class Bitset;
+
+    public:
+        /**
+         * Returns the index of the current `1` bit.
+         *
+         * @returns The bit index.
+         */
+        uint16_t operator*(void) const
+        {
+            return static_cast<uint16_t>(mWordIndex * kBitsPerWord + CountTrailingZeros(mWord));
+        }
+
+        /**
+         * Advances the iterator to the next `1` bit (pre-increment).
+         *
+         * @returns A reference to the iterator.
+         */
+        Iterator &operator++(void)
+        {
+            mWord &= mWord - 1;
+            SkipZeroWords();
+            return *this;
+        }
+
+        /**
+         * Overloads operator `==` to evaluate whether or not two iterators are equal.
+         *
+         * @param[in] aOther  The other iterator to compare with.
+         *
+         * @retval TRUE   The iterators are equal.
+         * @retval FALSE  The iterators are not equal.
+         */
+        bool operator==(const Iterator &aOther) const
+        {
+            return (mWordIndex == aOther.mWordIndex) && (mWord == aOther.mWord);
+        }
+
+        /**
+         * Overloads operator `!=` to evaluate whether or not two iterators are not equal.
+         *
+         * @param[in] aOther  The other iterator to compare with.
+         *
+         * @retval TRUE   The iterators are not equal.
+         * @retval FALSE  The iterators are equal.
+         */
+        bool operator!=(const Iterator &aOther) const { return !(*this == aOther); }
+
+    private:
+        // `mWord` holds the `1` bits of the current word not yet
+        // visited, so the current bit is its lowest `1` bit.
+
+        explicit Iterator(const Bitset &aBitset)
+            : mBitset(&aBitset)
+            , mWordIndex(0)
+            , mWord(aBitset.mWords[0])
+        {
+            SkipZeroWords();
+        }
+
+        Iterator(const Bitset &aBitset, uint16_t aWordIndex)
+            : mBitset(&aBitset)
+            , mWordIndex(aWordIndex)
+            , mWord(0)
+        {
+        }
+
+        void SkipZeroWords(void)
+        {
+            while ((mWord == 0) && (++mWordIndex < kNumWords))
+            {
+                mWord = mBitset->mWords[mWordIndex];
+            }
+        }
+
+        const Bitset *mBitset;
+        uint16_t      mWordIndex;
+        Word          mWord;
+    };
+
+    /**
+     * Initializes the bit set with all bits cleared.
+     */
+    Bitset(void) { ClearAll(); }
+
+    /**
+     * Returns the number of bits in the set (the `kNumBits` template parameter).
+     *
+     * @returns The number of bits.
+     */
+    uint16_t GetSize(void) const { return kNumBits; }
+
+    /**
+     * Indicates whether a given bit is set.
+     *
+     * @param[in] aIndex  The bit index (MUST be smaller than `kNumBits`).
+     *
+     * @retval TRUE   The bit is set.
+     * @retval FALSE  The bit is cleared.
+     */
+    bool IsSet(uint16_t aIndex) const { return (mWords[WordIndexOf(aIndex)] & BitMaskOf(aIndex)) != 0; }
+
+    /**
+     * Sets a given bit.
+     *
+     * @param[in] aIndex  The bit index (MUST be smaller than `kNumBits`).
+     */
+    void Set(uint16_t aIndex) { mWords[WordIndexOf(aIndex)] |= BitMaskOf(aIndex); }
+
+    /**
+     * Clears a given bit.
+     *
+     * @param[in] aIndex  The bit index (MUST be smaller than `kNumBits`).
+     */
+    void Clear(uint16_t aIndex) { mWords[WordIndexOf(aIndex)] &= ~BitMaskOf(aIndex); }
+
+    /**
+     * Sets or clears a given bit.
+     *
+     * @param[in] aIndex  The bit index (MUST be smaller than `kNumBits`).
+     * @param[in] aSet    TRUE to set the bit, FALSE to clear it.
+     */
+    void Update(uint16_t aIndex, bool aSet) { aSet ? Set(aIndex) : Clear(aIndex); }
+
+    /**
+     * Sets all the bits.
+     */
+    void SetAll(void)
+    {
+        for (Word &word : mWords)
+        {
+            word = kAllOnes;
+        }
+
+        mWords[kNumWords - 1] = kLastWordMask;
+    }
+
+    /**
+     * Clears all the bits.
+     */
+    void ClearAll(void)
+    {
+        for (Word &word : mWords)
+        {
+            word = 0;
+        }
+    }
+
+    /**
+     * Indicates whether all the bits are cleared.
+     *
+     * @retval TRUE   All the bits are cleared.
+     * @retval FALSE  At least one bit is set.
+     */
+    bool IsEmpty(void) const
+    {
+        Word combined = 0;
+
+        for (Word word : mWords)
+        {
+            combined |= word;
+        }
+
+        return combined == 0;
+    }
+
+    /**
+     * Returns the number of bits which are set (population count).
+     *
+     * @returns The number of set bits.
+     */
+    uint16_t GetCount(void) const
+    {
+        uint16_t count = 0;
+
+        for (Word word : mWords)
+        {
+            count += CountBitsInMask(word);
+        }
+
+        return count;
+    }
+
+    /**
+     * Finds the first set bit at or after a given index.
+     *
+     * @param[in] aStart  The index to start the search from.
+     *
+     * @returns The index of the first set bit at or after @p aStart, or `kNotFound` if there is none.
+     */
+    uint16_t FindFirstSet(uint16_t aStart = 0) const { return FindFirst(aStart, /* aInvert */ 0); }
+
+    /**
+     * Finds the first cleared bit at or after a given index.
+     *
+     * @param[in] aStart  The index to start the search from.
+     *
+     * @returns The index of the first cleared bit at or after @p aStart, or `kNotFound` if there is none.
+     */
+    uint16_t FindFirstClear(uint16_t aStart = 0) const { return FindFirst(aStart, /* aInvert */ kAllOnes); }
+
+    /**
+     * Finds the last (highest index) set bit.
+     *
+     * @returns The index of the last set bit, or `kNotFound` if there is none.
+     */
+    uint16_t FindLastSet(void) const
+    {
+        for (uint16_t wordIndex = kNumWords; wordIndex > 0; wordIndex--)
+        {
+            Word word = mWords[wordIndex - 1];
+
+            if (word != 0)
+            {
+                return static_cast<uint16_t>(wordIndex * kBitsPerWord - 1 - CountLeadingZeros(word));
+            }
+        }
+
+        return kNotFound;
+    }
+
+    /**
+     * Indicates whether the bit set has any set bit in common with another bit set.
+     *
+     * @param[in] aOther  The other bit set.
+     *
+     * @retval TRUE   At least one bit is set in both bit sets.
+     * @retval FALSE  No bit is set in both bit sets.
+     */
+    bool Intersects(const Bitset &aOther) const
+    {
+        Word combined = 0;
+
+        for (uint16_t index = 0; index < kNumWords; index++)
+        {
+            combined |= mWords[index] & aOther.mWords[index];
+        }
+
+        return combined != 0;
+    }
+
+    /**
+     * Keeps only the bits which are also set in another bit set (bitwise AND).
+     *
+     * @param[in] aOther  The other bit set.
+     *
+     * @returns A reference to this bit set.
+     */
+    Bitset &operator&=(const Bitset &aOther)
+    {
+        for (uint16_t index = 0; index < kNumWords; index++)
+        {
+            mWords[index] &= aOther.mWords[index];
+        }
+
+        return *this;
+    }
+
+    /**
+     * Sets the bits which are set in another bit set (bitwise OR).
+     *
+     * @param[in] aOther  The other bit set.
+     *
+     * @returns A reference to this bit set.
+     */
+    Bitset &operator|=(const Bitset &aOther)
+    {
+        for (uint16_t index = 0; index < kNumWords; index++)
+        {
+            mWords[index] |= aOther.mWords[index];
+        }
+
+        return *this;
+    }
+
+    /**
+     * Clears the bits which are set in another bit set (bitwise AND-NOT).
+     *
+     * @param[in] aOther  The other bit set.
+     *
+     * @returns A reference to this bit set.
+     */
+    Bitset &AndNot(const Bitset &aOther)
+    {
+        for (uint16_t index = 0; index < kNumWords; index++)
+        {
+            mWords[index] &= ~aOther.mWords[index];
+        }
+
+        return *this;
+    }
+
+    /**
+     * Overloads operator `==` to evaluate whether or not two bit sets are equal.
+     *
+     * @param[in] aOther  The other bit set to compare with.
+     *
+     * @retval TRUE   The two bit sets are equal.
+     * @retval FALSE  The two bit sets are not equal.
+     */
+    bool operator==(const Bitset &aOther) const
+    {
+        Word diff = 0;
+
+        for (uint16_t index = 0; index < kNumWords; index++)
+        {
+            diff |= mWords[index] ^ aOther.mWords[index];
+        }
+
+        return diff == 0;
+    }
+
+    /**
+     * Overloads operator `!=` to evaluate whether or not two bit sets are not equal.
+     *
+     * @param[in] aOther  The other bit set to compare with.
+     *
+     * @retval TRUE   The two bit sets are not equal.
+     * @retval FALSE  The two bit sets are equal.
+     */
+    bool operator!=(const Bitset &aOther) const { return !(*this == aOther); }
+
+    // The `begin()` and `end()` methods allow the bit set to be used
+    // in a range-based `for` loop over the indices of the set bits.
+
+    Iterator begin(void) const { return Iterator(*this); }
+    Iterator end(void) const { return Iterator(*this, kNumWords); }
+
+private:
+    static uint16_t WordIndexOf(uint16_t aIndex) { return aIndex / kBitsPerWord; }
+    static Word     BitMaskOf(uint16_t aIndex) { return static_cast<Word>(1) << (aIndex % kBitsPerWord); }
+
+    uint16_t FindFirst(uint16_t aStart, Word aInvert) const
+    {
+        // Searches for a `1` bit in the words XORed with `aInvert`,
+        // so all ones searches for a cleared bit. The bits below
+        // `aStart` in the first word are masked out.
+
+        uint16_t index = kNotFound;
+        uint16_t wordIndex;
+        Word     word;
+
+        VerifyOrExit(aStart < kNumBits);
+
+        wordIndex = WordIndexOf(aStart);
+        word      = (mWords[wordIndex] ^ aInvert) & (kAllOnes << (aStart % kBitsPerWord));
+
+        while (word == 0)
+        {
+            VerifyOrExit(++wordIndex < kNumWords);
+            word = mWords[wordIndex] ^ aInvert;
+        }
+
+        // A cleared bit found beyond `kNumBits` (in the last word) is
+        // not part of the set.
+        index = Min<uint16_t>(static_cast<uint16_t>(wordIndex * kBitsPerWord + CountTrailingZeros(word)), kNotFound);
+
+    exit:
+        return index;
+    }
+
+    Word mWords[kNumWords];
+};
+
+} // namespace ty
+
+#endif // BITSET_HPP_
@@ -0,0 +1,340 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for a lock-free byte FIFO with contiguous spans (bip-buffer).
+ */
+
+#ifndef BYTE_FIFO_HPP_
+#define BYTE_FIFO_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ty/common/atomic.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/debug.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/non_copyable.hpp"
+#include "ty/common/num_utils.hpp"
+
+namespace ty {
+
+/**
+ * Represents a lock-free single-producer single-consumer (SPSC) byte FIFO which hands out contiguous spans
+ * (bip-buffer).
+ *
+ * Unlike a ring buffer, the bytes are never split at the end of the buffer: the producer writes into a contiguous
+ * span (e.g., with `read()` or a DMA transfer) and the consumer parses the bytes in place, without copying them to
+ * handle the wrap-around. When the span at the end of the buffer is too short for the producer, it wraps to the start
+ * of the buffer and the end is left unused until the consumer reaches it (the watermark).
+ *
+ * One thread (the producer) calls `BeginWrite()` and `CommitWrite()` (or `Write()`), and one other thread (the
+ * consumer) calls `BeginRead()` and `CommitRead()` (or `Read()`), without any lock. As in `SpscRing`, the producer and
+ * consumer indices are in separate cache lines and each side keeps a cached copy of the other side's indices.
+ *
+ * @tparam kSize  The size of the buffer (in bytes).
+ */
+template <uint16_t kSize> class ByteFifo : private NonCopyable
+{
+    static_assert(kSize > 1, "ByteFifo `kSize` is too small");
+    static_assert(kSize < 0xffff, "ByteFifo `kSize` is too large");
+
+public:
+    /**
+     * Initializes the FIFO as empty.
+     */
+    ByteFifo(void) = default;
+
+    /**
+     * Returns the size of the buffer.
+     *
+     * @returns The size of the buffer (in bytes).
+     */
+    uint16_t GetSize(void) const { return kSize; }
+
+    /**
+     * Returns the number of bytes in the FIFO.
+     *
+     * The result is exact only when called from the producer or the consumer thread while the other side is not
+     * active, otherwise it is a snapshot which may already be out of date.
+     *
+     * @returns The number of bytes.
+     */
+    uint16_t GetLength(void) const
+    {
+        uint16_t read      = mConsumer.mRead.Load(kMemoryOrderAcquire);
+        uint16_t write     = mProducer.mWrite.Load(kMemoryOrderAcquire);
+        uint16_t watermark = mProducer.mWatermark.Load(kMemoryOrderAcquire);
+
+        return (write >= read) ? static_cast<uint16_t>(write - read) : static_cast<uint16_t>(watermark - read + write);
+    }
+
+    /**
+     * Indicates whether or not the FIFO is empty.
+     *
+     * @retval TRUE   The FIFO is empty.
+     * @retval FALSE  The FIFO is not empty.
+     */
+    bool IsEmpty(void) const { return GetLength() == 0; }
+
+    /**
+     * Gets a contiguous span to write bytes into. MUST only be called from the producer thread.
+     *
+     * The span is the free space after the last written byte or, if it is shorter than @p aMinLength, the free space
+     * at the start of the buffer. The bytes are added to the FIFO by `CommitWrite()`, and the span remains valid until
+     * then (a new call to `BeginWrite()` replaces it).
+     *
+     * @param[in]  aMinLength  The minimum length of the span (zero is handled as one).
+     * @param[out] aBuffer     A reference to output a pointer to the span.
+     * @param[out] aLength     A reference to output the length of the span (at least @p aMinLength).
+     *
+     * @retval kErrorNone    Successfully got a span.
+     * @retval kErrorNoBufs  There is no contiguous free span of @p aMinLength bytes.
+     */
+    Error BeginWrite(uint16_t aMinLength, uint8_t *&aBuffer, uint16_t &aLength)
+    {
+        Error    error     = kErrorNone;
+        uint16_t write     = mProducer.mWrite.Load(kMemoryOrderRelaxed);
+        uint16_t minLength = Max<uint16_t>(aMinLength, 1);
+        uint16_t start;
+        uint16_t length;
+
+        if (!FindWriteSpan(write, mProducer.mCachedRead, minLength, start, length))
+        {
+            mProducer.mCachedRead = mConsumer.mRead.Load(kMemoryOrderAcquire);
+            VerifyOrExit(FindWriteSpan(write, mProducer.mCachedRead, minLength, start, length), error = kErrorNoBufs);
+        }
+
+        mProducer.mSpanStart  = start;
+        mProducer.mSpanLength = length;
+
+        aBuffer = &mBuffer[start];
+        aLength = length;
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Adds bytes written into the span from `BeginWrite()` to the FIFO. MUST only be called from the producer thread.
+     *
+     * @param[in] aLength  The number of bytes written at the start of the span (MUST NOT exceed its length).
+     */
+    void CommitWrite(uint16_t aLength)
+    {
+        uint16_t write = mProducer.mWrite.Load(kMemoryOrderRelaxed);
+        uint16_t newWrite;
+
+        TY_ASSERT(aLength <= mProducer.mSpanLength);
+        VerifyOrExit(aLength > 0);
+
+        newWrite = static_cast<uint16_t>(mProducer.mSpanStart + aLength);
+
+        // The watermark (end of the bytes to read before wrapping) is
+        // published before the write index, so the consumer sees it
+        // when it sees the wrapped write index. Once the consumer has
+        // wrapped and the bytes pass the old watermark, it is reset to
+        // the end of the buffer.
+
+        if (newWrite < write)
+        {
+            mProducer.mWatermark.Store(write, kMemoryOrderRelease);
+        }
+        else if (newWrite > mProducer.mWatermark.Load(kMemoryOrderRelaxed))
+        {
+            mProducer.mWatermark.Store(kSize, kMemoryOrderRelease);
+        }
+
+        mProducer.mWrite.Store(newWrite, kMemoryOrderRelease);
+        mProducer.mSpanLength = 0;
+
+    exit:
+        return;
+    }
+
+    /**
+     * Writes bytes to the FIFO (copying them into one or two spans). MUST only be called from the producer thread.
+     *
+     * If there is not enough free space for all the bytes, as many as fit are written.
+     *
+     * @param[in] aBuf     A pointer to the bytes to write.
+     * @param[in] aLength  The number of bytes to write.
+     *
+     * @returns The number of bytes written.
+     */
+    uint16_t Write(const void *aBuf, uint16_t aLength)
+    {
+        const uint8_t *bytes   = static_cast<const uint8_t *>(aBuf);
+        uint16_t       written = 0;
+
+        while (written < aLength)
+        {
+            uint8_t *buffer;
+            uint16_t length;
+
+            SuccessOrExit(BeginWrite(1, buffer, length));
+
+            length = Min<uint16_t>(length, aLength - written);
+            memcpy(buffer, bytes + written, length);
+            CommitWrite(length);
+            written += length;
+        }
+
+    exit:
+        return written;
+    }
+
+    /**
+     * Gets the contiguous span of the oldest bytes in the FIFO. MUST only be called from the consumer thread.
+     *
+     * The bytes are removed from the FIFO by `CommitRead()`, and the span remains valid until then. The FIFO can hold
+     * more bytes (wrapped to the start of the buffer) than the span.
+     *
+     * @param[out] aBuffer  A reference to output a pointer to the span.
+     * @param[out] aLength  A reference to output the length of the span.
+     *
+     * @retval kErrorNone      Successfully got a span.
+     * @retval kErrorNotFound  The FIFO is empty.
+     */
+    Error BeginRead(const uint8_t *&aBuffer, uint16_t &aLength)
+    {
+        Error    error = kErrorNone;
+        uint16_t read  = mConsumer.mRead.Load(kMemoryOrderRelaxed);
+        uint16_t length;
+
+        length = GetReadLength(read);
+
+        if (length == 0)
+        {
+            mConsumer.mCachedWrite     = mProducer.mWrite.Load(kMemoryOrderAcquire);
+            mConsumer.mCachedWatermark = mProducer.mWatermark.Load(kMemoryOrderAcquire);
+            length                     = GetReadLength(read);
+            VerifyOrExit(length > 0, error = kErrorNotFound);
+        }
+
+        mConsumer.mSpanLength = length;
+
+        aBuffer = &mBuffer[read];
+        aLength = length;
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Removes bytes read from the span from `BeginRead()` from the FIFO. MUST only be called from the consumer thread.
+     *
+     * @param[in] aLength  The number of bytes read at the start of the span (MUST NOT exceed its length).
+     */
+    void CommitRead(uint16_t aLength)
+    {
+        TY_ASSERT(aLength <= mConsumer.mSpanLength);
+
+        mConsumer.mRead.Store(static_cast<uint16_t>(mConsumer.mRead.Load(kMemoryOrderRelaxed) + aLength),
+                              kMemoryOrderRelease);
+        mConsumer.mSpanLength = static_cast<uint16_t>(mConsumer.mSpanLength - aLength);
+    }
+
+    /**
+     * Reads bytes from the FIFO (copying them from one or two spans). MUST only be called from the consumer thread.
+     *
+     * @param[out] aBuf        A pointer to a buffer to output the bytes.
+     * @param[in]  aMaxLength  The maximum number of bytes to read (the size of @p aBuf).
+     *
+     * @returns The number of bytes read.
+     */
+    uint16_t Read(void *aBuf, uint16_t aMaxLength)
+    {
+        uint8_t *bytes = static_cast<uint8_t *>(aBuf);
+        uint16_t count = 0;
+
+        while (count < aMaxLength)
+        {
+            const uint8_t *buffer;
+            uint16_t       length;
+
+            SuccessOrExit(BeginRead(buffer, length));
+
+            length = Min<uint16_t>(length, aMaxLength - count);
+            memcpy(bytes + count, buffer, length);
+            CommitRead(length);
+            count += length;
+        }
+
+    exit:
+        return count;
+    }
+
+private:
+    // The bytes are in `[read, write)` if `write >= read`, otherwise
+    // in `[read, watermark)` followed by `[0, write)`. One byte is left
+    // free between `write` and `read` so that `write == read` only when
+    // the FIFO is empty.
+
+    struct alignas(TY_CONFIG_CACHE_LINE_SIZE) ProducerState
+    {
+        Atomic<uint16_t> mWrite;
+        Atomic<uint16_t> mWatermark{kSize};
+        uint16_t         mCachedRead = 0;
+        uint16_t         mSpanStart  = 0;
+        uint16_t         mSpanLength = 0;
+    };
+
+    struct alignas(TY_CONFIG_CACHE_LINE_SIZE) ConsumerState
+    {
+        Atomic<uint16_t> mRead;
+        uint16_t         mCachedWrite     = 0;
+        uint16_t         mCachedWatermark = kSize;
+        uint16_t         mSpanLength      = 0;
+    };
+
+    // A stale read index only makes the free space look smaller: the
+    // consumer only moves forward or wraps after the producer wrapped.
+    static bool FindWriteSpan(uint16_t aWrite, uint16_t aRead, uint16_t aMinLength, uint16_t &aStart, uint16_t &aLength)
+    {
+        aStart = aWrite;
+
+        if (aWrite < aRead)
+        {
+            aLength = static_cast<uint16_t>(aRead - aWrite - 1);
+        }
+        else if (kSize - aWrite >= aMinLength)
+        {
+            aLength = static_cast<uint16_t>(kSize - aWrite);
+        }
+        else
+        {
+            aStart  = 0;
+            aLength = (aRead > 0) ? static_cast<uint16_t>(aRead - 1) : 0;
+        }
+
+        return (aLength >= aMinLength);
+    }
+
+    // Uses the cached write index and watermark, and wraps the read
+    // index once all the bytes before the watermark are read.
+    uint16_t GetReadLength(uint16_t &aRead)
+    {
+        uint16_t write = mConsumer.mCachedWrite;
+
+        if ((write < aRead) && (aRead == mConsumer.mCachedWatermark))
+        {
+            aRead = 0;
+            mConsumer.mRead.Store(0, kMemoryOrderRelease);
+        }
+
+        return static_cast<uint16_t>(((write < aRead) ? mConsumer.mCachedWatermark : write) - aRead);
+    }
+
+    ProducerState mProducer;
+    ConsumerState mConsumer;
+    uint8_t       mBuffer[kSize];
+};
+
+} // namespace ty
+
+#endif // BYTE_FIFO_HPP_
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes helper functions to add or remove the `const` qualifier of an object.
+ */
+
+#ifndef TY_CONST_CAST_HPP_
+#define TY_CONST_CAST_HPP_
+
+namespace ty {
+
+/**
+ * Casts a given non-const reference to a const reference.
+ *
+ * @tparam Type   The type to cast.
+ *
+ * @param[in] aObject   A reference to an object.
+ *
+ * @returns A const reference to @p aObject.
+ */
+template <typename Type> const Type &AsConst(Type &aObject) { return const_cast<const Type &>(aObject); }
+
+/**
+ * Casts a given non-const pointer to a const pointer.
+ *
+ * @tparam Type   The type to cast.
+ *
+ * @param[in] aPointer   A pointer to an object.
+ *
+ * @returns A const pointer to @p aPointer.
+ */
+template <typename Type> const Type *AsConst(Type *aPointer) { return const_cast<const Type *>(aPointer); }
+
+/**
+ * Casts a given const reference to a non-const reference.
+ *
+ * @tparam Type   The type to cast.
+ *
+ * @param[in] aObject   A const reference to an object.
+ *
+ * @returns A non-const reference to @p aObject.
+ */
+template <typename Type> Type &AsNonConst(const Type &aObject) { return const_cast<Type &>(aObject); }
+
+/**
+ * Casts a given const pointer to a non-const pointer.
+ *
+ * @tparam Type   The type to cast.
+ *
+ * @param[in] aPointer   A const pointer to an object.
+ *
+ * @returns A non-const pointer to @p aPointer.
+ */
+template <typename Type> Type *AsNonConst(const Type *aPointer) { return const_cast<Type *>(aPointer); }
+
+} // namespace ty
+
+#endif // TY_CONST_CAST_HPP_
@@ -0,0 +1,247 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions of non-cryptographic hash functions.
+ */
+
+#ifndef TY_HASH_HPP_
+#define TY_HASH_HPP_
+
+#include <stdint.h>
+
+namespace ty {
+
+static constexpr uint32_t kFnv1a32OffsetBasis = 0x811c9dc5u;           ///< 32-bit FNV-1a offset basis.
+static constexpr uint32_t kFnv1a32Prime       = 0x01000193u;           ///< 32-bit FNV-1a prime.
+static constexpr uint64_t kFnv1a64OffsetBasis = 0xcbf29ce484222325ull; ///< 64-bit FNV-1a offset basis.
+static constexpr uint64_t kFnv1a64Prime       = 0x00000100000001b3ull; ///< 64-bit FNV-1a prime.
+
+/**
+ * Calculates the 32-bit FNV-1a hash of a null-terminated string.
+ *
+ * Is `constexpr` so it can be used to hash string literals (e.g., module names or keys) at compile time. The
+ * terminating null character is not included in the hash, so the result is the same as hashing the characters of the
+ * string using `Fnv1a32(aChars, aLength)`.
+ *
+ * @param[in] aString  A pointer to the null-terminated string.
+ *
+ * @returns The 32-bit FNV-1a hash.
+ */
+constexpr uint32_t Fnv1a32(const char *aString)
+{
+    uint32_t hash = kFnv1a32OffsetBasis;
+
+    for (; *aString != '\0'; aString++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*aString)) * kFnv1a32Prime;
+    }
+
+    return hash;
+}
+
+/**
+ * Calculates the 32-bit FNV-1a hash of a given number of characters.
+ *
+ * @param[in] aChars   A pointer to the characters (not required to be null-terminated).
+ * @param[in] aLength  The number of characters in @p aChars.
+ * @param[in] aHash    The initial hash value. Can be used to continue the hash of a previous string.
+ *
+ * @returns The 32-bit FNV-1a hash.
+ */
+constexpr uint32_t Fnv1a32(const char *aChars, uint16_t aLength, uint32_t aHash = kFnv1a32OffsetBasis)
+{
+    for (uint16_t index = 0; index < aLength; index++)
+    {
+        aHash = (aHash ^ static_cast<uint8_t>(aChars[index])) * kFnv1a32Prime;
+    }
+
+    return aHash;
+}
+
+/**
+ * Calculates the 32-bit FNV-1a hash of a given byte sequence.
+ *
+ * @param[in] aBytes   A pointer to the bytes.
+ * @param[in] aLength  The number of bytes in @p aBytes.
+ * @param[in] aHash    The initial hash value. Can be used to continue the hash of a previous byte sequence.
+ *
+ * @returns The 32-bit FNV-1a hash.
+ */
+constexpr uint32_t Fnv1a32(const uint8_t *aBytes, uint16_t aLength, uint32_t aHash = kFnv1a32OffsetBasis)
+{
+    for (uint16_t index = 0; index < aLength; index++)
+    {
+        aHash = (aHash ^ aBytes[index]) * kFnv1a32Prime;
+    }
+
+    return aHash;
+}
+
+/**
+ * Calculates the 64-bit FNV-1a hash of a null-terminated string.
+ *
+ * The terminating null character is not included in the hash.
+ *
+ * @param[in] aString  A pointer to the null-terminated string.
+ *
+ * @returns The 64-bit FNV-1a hash.
+ */
+constexpr uint64_t Fnv1a64(const char *aString)
+{
+    uint64_t hash = kFnv1a64OffsetBasis;
+
+    for (; *aString != '\0'; aString++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*aString)) * kFnv1a64Prime;
+    }
+
+    return hash;
+}
+
+/**
+ * Calculates the 64-bit FNV-1a hash of a given number of characters.
+ *
+ * @param[in] aChars   A pointer to the characters (not required to be null-terminated).
+ * @param[in] aLength  The number of characters in @p aChars.
+ * @param[in] aHash    The initial hash value. Can be used to continue the hash of a previous string.
+ *
+ * @returns The 64-bit FNV-1a hash.
+ */
+constexpr uint64_t Fnv1a64(const char *aChars, uint16_t aLength, uint64_t aHash = kFnv1a64OffsetBasis)
+{
+    for (uint16_t index = 0; index < aLength; index++)
+    {
+        aHash = (aHash ^ static_cast<uint8_t>(aChars[index])) * kFnv1a64Prime;
+    }
+
+    return aHash;
+}
+
+/**
+ * Calculates the 64-bit FNV-1a hash of a given byte sequence.
+ *
+ * @param[in] aBytes   A pointer to the bytes.
+ * @param[in] aLength  The number of bytes in @p aBytes.
+ * @param[in] aHash    The initial hash value. Can be used to continue the hash of a previous byte sequence.
+ *
+ * @returns The 64-bit FNV-1a hash.
+ */
+constexpr uint64_t Fnv1a64(const uint8_t *aBytes, uint16_t aLength, uint64_t aHash = kFnv1a64OffsetBasis)
+{
+    for (uint16_t index = 0; index < aLength; index++)
+    {
+        aHash = (aHash ^ aBytes[index]) * kFnv1a64Prime;
+    }
+
+    return aHash;
+}
+
+/**
+ * Calculates a 32-bit hash of a 32-bit integer value.
+ *
+ * Uses the finalizer of MurmurHash3, which mixes every input bit into every output bit, so that any subset of the
+ * hash bits (e.g., the low bits used to index a power-of-two table) is well distributed even for sequential values.
+ *
+ * @param[in] aValue  The value to hash.
+ *
+ * @returns The 32-bit hash.
+ */
+constexpr uint32_t HashUint32(uint32_t aValue)
+{
+    aValue ^= aValue >> 16;
+    aValue *= 0x85ebca6bu;
+    aValue ^= aValue >> 13;
+    aValue *= 0xc2b2ae35u;
+    aValue ^= aValue >> 16;
+
+    return aValue;
+}
+
+/**
+ * Calculates a 32-bit hash of a 64-bit integer value.
+ *
+ * Uses the 64-bit finalizer of MurmurHash3 and folds the result to 32 bits.
+ *
+ * @param[in] aValue  The value to hash.
+ *
+ * @returns The 32-bit hash.
+ */
+constexpr uint32_t HashUint64(uint64_t aValue)
+{
+    aValue ^= aValue >> 33;
+    aValue *= 0xff51afd7ed558ccdull;
+    aValue ^= aValue >> 33;
+    aValue *= 0xc4ceb9fe1a85ec53ull;
+    aValue ^= aValue >> 33;
+
+    return static_cast<uint32_t>(aValue) ^ static_cast<uint32_t>(aValue >> 32);
+}
+
+/**
+ * Provides the hash function of a given type, e.g., for use as a key in a `HashMap`.
+ *
+ * The generic version uses the `GetHash()` method of `Type`, which MUST be provided as:
+ *
+ *     uint32_t Type::GetHash(void) const;
+ *
+ * Specializations are provided for the integer types.
+ *
+ * @tparam Type  The type to hash.
+ */
+template <typename Type> struct Hasher
+{
+    /**
+     * Calculates the hash of a given value.
+     *
+     * @param[in] aValue  The value to hash.
+     *
+     * @returns The 32-bit hash.
+     */
+    static uint32_t Hash(const Type &aValue) { return aValue.GetHash(); }
+};
+
+template <> struct Hasher<uint8_t>
+{
+    static constexpr uint32_t Hash(uint8_t aValue) { return HashUint32(aValue); }
+};
+
+template <> struct Hasher<uint16_t>
+{
+    static constexpr uint32_t Hash(uint16_t aValue) { return HashUint32(aValue); }
+};
+
+template <> struct Hasher<uint32_t>
+{
+    static constexpr uint32_t Hash(uint32_t aValue) { return HashUint32(aValue); }
+};
+
+template <> struct Hasher<uint64_t>
+{
+    static constexpr uint32_t Hash(uint64_t aValue) { return HashUint64(aValue); }
+};
+
+template <> struct Hasher<int8_t>
+{
+    static constexpr uint32_t Hash(int8_t aValue) { return HashUint32(static_cast<uint32_t>(aValue)); }
+};
+
+template <> struct Hasher<int16_t>
+{
+    static constexpr uint32_t Hash(int16_t aValue) { return HashUint32(static_cast<uint32_t>(aValue)); }
+};
+
+template <> struct Hasher<int32_t>
+{
+    static constexpr uint32_t Hash(int32_t aValue) { return HashUint32(static_cast<uint32_t>(aValue)); }
+};
+
+template <> struct Hasher<int64_t>
+{
+    static constexpr uint32_t Hash(int64_t aValue) { return HashUint64(static_cast<uint64_t>(aValue)); }
+};
+
+} // namespace ty
+
+#endif // TY_HASH_HPP_
@@ -0,0 +1,473 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for a fixed-capacity hash map.
+ */
+
+#ifndef HASH_MAP_HPP_
+#define HASH_MAP_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/const_cast.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/hash.hpp"
+#include "ty/common/type_traits.hpp"
+
+namespace ty {
+
+/**
+ * Represents a hash map with a fixed capacity, using open addressing with Robin Hood hashing.
+ *
+ * The entries are stored in the object itself (no heap), in a power-of-two number of slots chosen at compile time so
+ * that the load factor stays below 8/9 when the map is full. The entries in all the slots are constructed along with
+ * the map, similar to `Array`, and entries are copied or moved (using `=` operator) into them.
+ *
+ * An entry is placed at the first free slot probing linearly from the slot selected by its key hash. While probing,
+ * an entry further from its own slot displaces one that is closer to its own slot (Robin Hood), which keeps the probe
+ * distances short and uniform. A lookup stops as soon as it reaches an entry closer to its own slot than the key
+ * would be, so missing keys are found to be missing quickly. Removal shifts the following entries back by one slot
+ * instead of leaving a tombstone, so lookups never slow down as entries are added and removed.
+ *
+ * Keys are compared using the `==` operator on `Key`.
+ *
+ * @tparam Key        The key type.
+ * @tparam Value      The value type.
+ * @tparam kCapacity  The maximum number of entries in the map.
+ * @tparam KeyHasher  The hasher of `Key`, which MUST provide `static uint32_t Hash(const Key &aKey)`. If not
+ *                    specified, `Hasher<Key>` is used.
+ */
+template <typename Key, typename Value, uint16_t kCapacity, typename KeyHasher = Hasher<Key>> class HashMap
+{
+    static_assert(kCapacity != 0, "HashMap `kCapacity` cannot be zero");
+    static_assert(kCapacity <= 0x7000, "HashMap `kCapacity` is too large");
+
+public:
+    /**
+     * Represents an entry (a key and its value) in the map.
+     */
+    class Entry
+    {
+        friend class HashMap;
+
+    public:
+        /**
+         * Returns the key of the entry.
+         *
+         * @returns The key.
+         */
+        const Key &GetKey(void) const { return mKey; }
+
+        /**
+         * Returns the value of the entry.
+         *
+         * @returns A reference to the value.
+         */
+        Value &GetValue(void) { return mValue; }
+
+        /**
+         * Returns the value of the entry.
+         *
+         * @returns A reference to the value.
+         */
+        const Value &GetValue(void) const { return mValue; }
+
+    private:
+        Key   mKey;
+        Value mValue;
+    };
+
+    /**
+     * Initializes the map as empty.
+     */
+    HashMap(void) { Clear(); }
+
+    /**
+     * Clears the map.
+     */
+    void Clear(void)
+    {
+        memset(mDistances, 0, sizeof(mDistances));
+        mLength = 0;
+    }
+
+    /**
+     * Indicates whether or not the map is empty.
+     *
+     * @retval TRUE when the map is empty.
+     * @retval FALSE when the map is not empty.
+     */
+    bool IsEmpty(void) const { return (mLength == 0); }
+
+    /**
+     * Indicates whether or not the map is full.
+     *
+     * @retval TRUE when the map is full.
+     * @retval FALSE when the map is not full.
+     */
+    bool IsFull(void) const { return (mLength == kCapacity); }
+
+    /**
+     * Returns the number of entries in the map.
+     *
+     * @returns The number of entries.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * Returns the capacity of the map (maximum number of entries).
+     *
+     * @returns The capacity.
+     */
+    uint16_t GetCapacity(void) const { return kCapacity; }
+
+    /**
+     * Finds the value of a given key in the map.
+     *
+     * @param[in] aKey  The key to search for.
+     *
+     * @returns A pointer to the value, or `nullptr` if @p aKey is not in the map.
+     */
+    Value *Find(const Key &aKey) { return AsNonConst(AsConst(this)->Find(aKey)); }
+
+    /**
+     * Finds the value of a given key in the map.
+     *
+     * @param[in] aKey  The key to search for.
+     *
+     * @returns A pointer to the value, or `nullptr` if @p aKey is not in the map.
+     */
+    const Value *Find(const Key &aKey) const
+    {
+        uint16_t index;
+
+        return FindIndex(aKey, KeyHasher::Hash(aKey), index) ? &mEntries[index].mValue : nullptr;
+    }
+
+    /**
+     * Indicates whether or not the map contains a given key.
+     *
+     * @param[in] aKey  The key to search for.
+     *
+     * @retval TRUE   The map contains @p aKey.
+     * @retval FALSE  The map does not contain @p aKey.
+     */
+    bool Contains(const Key &aKey) const { return Find(aKey) != nullptr; }
+
+    /**
+     * Inserts a key and its value in the map, or replaces the value if the key is already in the map.
+     *
+     * The method uses assignment `=` operator on `Value` to copy @p aValue into the map.
+     *
+     * @param[in] aKey    The key.
+     * @param[in] aValue  The value.
+     *
+     * @retval kErrorNone    Successfully inserted (or replaced) the entry.
+     * @retval kErrorNoBufs  The map is full (and does not contain @p aKey).
+     */
+    Error Insert(const Key &aKey, const Value &aValue) { return InsertValue(aKey, aValue); }
+
+    /**
+     * Inserts a key and its value in the map, or replaces the value if the key is already in the map.
+     *
+     * The method uses move assignment `=` operator on `Value` to move @p aValue into the map.
+     *
+     * @param[in] aKey    The key.
+     * @param[in] aValue  The value.
+     *
+     * @retval kErrorNone    Successfully inserted (or replaced) the entry.
+     * @retval kErrorNoBufs  The map is full (and does not contain @p aKey).
+     */
+    Error Insert(const Key &aKey, Value &&aValue) { return InsertValue(aKey, Move(aValue)); }
+
+    /**
+     * Finds the value of a given key in the map, inserting the key with a value-initialized value (i.e., default
+     * constructed, or zero for scalar types) if it is not already in the map.
+     *
+     * @param[in] aKey  The key.
+     *
+     * @returns A pointer to the value, or `nullptr` if @p aKey is not in the map and the map is full.
+     */
+    Value *FindOrInsert(const Key &aKey)
+    {
+        Value   *value = nullptr;
+        uint32_t hash  = KeyHasher::Hash(aKey);
+        uint16_t index;
+
+        if (!FindIndex(aKey, hash, index))
+        {
+            Entry entry{};
+
+            VerifyOrExit(!IsFull());
+
+            entry.mKey = aKey;
+            index      = Place(entry, hash);
+        }
+
+        value = &mEntries[index].mValue;
+
+    exit:
+        return value;
+    }
+
+    /**
+     * Removes a given key (and its value) from the map.
+     *
+     * @param[in] aKey  The key to remove.
+     *
+     * @retval kErrorNone      Successfully removed the entry.
+     * @retval kErrorNotFound  The map does not contain @p aKey.
+     */
+    Error Remove(const Key &aKey)
+    {
+        Error    error = kErrorNone;
+        uint16_t index;
+        uint16_t next;
+
+        VerifyOrExit(FindIndex(aKey, KeyHasher::Hash(aKey), index), error = kErrorNotFound);
+
+        // Shift back the following entries until reaching an empty
+        // slot or an entry which is in its own slot (distance one).
+
+        for (next = NextIndex(index); mDistances[next] > 1; index = next, next = NextIndex(next))
+        {
+            mEntries[index]   = Move(mEntries[next]);
+            mDistances[index] = static_cast<Distance>(mDistances[next] - 1);
+        }
+
+        mDistances[index] = 0;
+        mLength--;
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Represents an iterator over the entries in the map.
+     *
+     * The entries are visited in an unspecified order. Inserting or removing entries invalidates the iterators.
+     *
+     * @tparam EntryType  The entry type (`Entry` or `const Entry`).
+     * @tparam MapType    The map type (`HashMap` or `const HashMap`).
+     */
+    template <typename EntryType, typename MapType> class IteratorBase
+    {
+        friend class HashMap;
+
+    public:
+        /**
+         * Overloads the `*` dereference operator and gets a reference to the entry the iterator is pointing to.
+         *
+         * @returns A reference to the entry.
+         */
+        EntryType &operator*(void) const { return mMap->mEntries[mIndex]; }
+
+        /**
+         * Overloads the `->` dereference operator and gets a pointer to the entry the iterator is pointing to.
+         *
+         * @returns A pointer to the entry.
+         */
+        EntryType *operator->(void) const { return &mMap->mEntries[mIndex]; }
+
+        /**
+         * Overloads the `++` operator (pre-increment) to move the iterator to the next entry.
+         *
+         * @returns A reference to the iterator.
+         */
+        IteratorBase &operator++(void)
+        {
+            mIndex++;
+            SkipEmptySlots();
+            return *this;
+        }
+
+        /**
+         * Overloads the `==` operator to evaluate whether two iterators are equal.
+         *
+         * @param[in] aOther  The other iterator to compare with.
+         *
+         * @retval TRUE   The iterators are equal.
+         * @retval FALSE  The iterators are not equal.
+         */
+        bool operator==(const IteratorBase &aOther) const { return (mIndex == aOther.mIndex); }
+
+        /**
+         * Overloads the `!=` operator to evaluate whether two iterators are unequal.
+         *
+         * @param[in] aOther  The other iterator to compare with.
+         *
+         * @retval TRUE   The iterators are not equal.
+         * @retval FALSE  The iterators are equal.
+         */
+        bool operator!=(const IteratorBase &aOther) const { return !(*this == aOther); }
+
+    private:
+        IteratorBase(MapType &aMap, uint16_t aIndex)
+            : mMap(&aMap)
+            , mIndex(aIndex)
+        {
+            SkipEmptySlots();
+        }
+
+        void SkipEmptySlots(void)
+        {
+            while ((mIndex < kNumSlots) && (mMap->mDistances[mIndex] == 0))
+            {
+                mIndex++;
+            }
+        }
+
+        MapType *mMap;
+        uint16_t mIndex;
+    };
+
+    typedef IteratorBase<Entry, HashMap>             Iterator;      ///< The iterator type.
+    typedef IteratorBase<const Entry, const HashMap> ConstIterator; ///< The const iterator type.
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the map entries and should not be used
+    // directly.
+
+    Iterator      begin(void) { return Iterator(*this, 0); }
+    Iterator      end(void) { return Iterator(*this, kNumSlots); }
+    ConstIterator begin(void) const { return ConstIterator(*this, 0); }
+    ConstIterator end(void) const { return ConstIterator(*this, kNumSlots); }
+
+private:
+    static constexpr uint16_t NumSlotsFor(uint16_t aCapacity)
+    {
+        // Smallest power of two larger than `aCapacity * 9 / 8`, so
+        // there is always at least one empty slot.
+
+        uint32_t minSlots = static_cast<uint32_t>(aCapacity) + aCapacity / 8 + 1;
+        uint32_t numSlots = 1;
+
+        while (numSlots < minSlots)
+        {
+            numSlots <<= 1;
+        }
+
+        return static_cast<uint16_t>(numSlots);
+    }
+
+    static constexpr uint16_t kNumSlots = NumSlotsFor(kCapacity);
+
+    // `mDistances[i]` is the probe distance plus one of the entry in
+    // slot `i` (one when the entry is in its own slot), or zero if
+    // the slot is empty. The distances never exceed the number of
+    // slots, so `uint8_t` is used when it is enough.
+
+    typedef typename TypeTraits::Conditional<(kNumSlots < 256), uint8_t, uint16_t>::Type Distance;
+
+    static uint16_t HomeIndex(uint32_t aHash) { return static_cast<uint16_t>(aHash & (kNumSlots - 1)); }
+    static uint16_t NextIndex(uint16_t aIndex) { return static_cast<uint16_t>((aIndex + 1) & (kNumSlots - 1)); }
+
+    static void Swap(Entry &aFirst, Entry &aSecond)
+    {
+        Entry entry = Move(aFirst);
+
+        aFirst  = Move(aSecond);
+        aSecond = Move(entry);
+    }
+
+    bool FindIndex(const Key &aKey, uint32_t aHash, uint16_t &aIndex) const
+    {
+        bool     found    = false;
+        uint16_t index    = HomeIndex(aHash);
+        Distance distance = 1;
+
+        // Stops at an empty slot (zero distance) or at an entry which
+        // is closer to its own slot than `aKey` would be, since Robin
+        // Hood insertion would have placed `aKey` before it.
+
+        for (; mDistances[index] >= distance; index = NextIndex(index), distance++)
+        {
+            if ((mDistances[index] == distance) && (mEntries[index].mKey == aKey))
+            {
+                aIndex = index;
+                found  = true;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+    uint16_t Place(Entry &aEntry, uint32_t aHash)
+    {
+        // Places a new entry (whose key is not in the map). Returns
+        // the slot where the new entry is placed. The map MUST NOT be
+        // full. `aEntry` is used to carry the displaced entries.
+
+        uint16_t index       = HomeIndex(aHash);
+        uint16_t placedIndex = kNumSlots;
+        Distance distance    = 1;
+
+        for (;; index = NextIndex(index), distance++)
+        {
+            if (mDistances[index] == 0)
+            {
+                mEntries[index]   = Move(aEntry);
+                mDistances[index] = distance;
+                break;
+            }
+
+            if (mDistances[index] < distance)
+            {
+                Distance displacedDistance = mDistances[index];
+
+                Swap(mEntries[index], aEntry);
+                mDistances[index] = distance;
+                distance          = displacedDistance;
+
+                if (placedIndex == kNumSlots)
+                {
+                    placedIndex = index;
+                }
+            }
+        }
+
+        mLength++;
+
+        return (placedIndex == kNumSlots) ? index : placedIndex;
+    }
+
+    template <typename ValueType> Error InsertValue(const Key &aKey, ValueType &&aValue)
+    {
+        Error    error = kErrorNone;
+        uint32_t hash  = KeyHasher::Hash(aKey);
+        uint16_t index;
+
+        if (FindIndex(aKey, hash, index))
+        {
+            mEntries[index].mValue = Forward<ValueType>(aValue);
+        }
+        else
+        {
+            Entry entry;
+
+            VerifyOrExit(!IsFull(), error = kErrorNoBufs);
+
+            entry.mKey   = aKey;
+            entry.mValue = Forward<ValueType>(aValue);
+            IgnoreReturnValue(Place(entry, hash));
+        }
+
+    exit:
+        return error;
+    }
+
+    Entry    mEntries[kNumSlots];
+    Distance mDistances[kNumSlots];
+    uint16_t mLength;
+};
+
+} // namespace ty
+
+#endif // HASH_MAP_HPP_
@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for an intrusive indexed binary heap.
+ */
+
+#ifndef INDEXED_HEAP_HPP_
+#define INDEXED_HEAP_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/debug.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/non_copyable.hpp"
+
+namespace ty {
+
+template <typename Type, uint16_t kMaxSize> class IndexedHeap;
+
+/**
+ * Represents an entry of an `IndexedHeap`.
+ *
+ * The entry holds its position in the heap, so that the heap can find it in constant time to remove it or to move it
+ * when its key changes. An entry can only be in one heap at a time.
+ */
+class IndexedHeapEntry
+{
+    template <typename, uint16_t> friend class IndexedHeap;
+
+public:
+    /**
+     * Initializes the entry as not in a heap.
+     */
+    IndexedHeapEntry(void)
+        : mHeapIndex(kNotInHeap)
+    {
+    }
+
+    /**
+     * Indicates whether or not the entry is in a heap.
+     *
+     * @retval TRUE   The entry is in a heap.
+     * @retval FALSE  The entry is not in a heap.
+     */
+    bool IsInHeap(void) const { return (mHeapIndex != kNotInHeap); }
+
+private:
+    static constexpr uint16_t kNotInHeap = 0xffff;
+
+    uint16_t mHeapIndex;
+};
+
+/**
+ * Represents an intrusive binary min-heap with a fixed max size.
+ *
+ * The heap holds pointers to its entries (it does not own nor copy them), and each entry holds its position in the
+ * heap (see `IndexedHeapEntry`). The first entry (e.g., the earliest deadline) is found in constant time, while adding
+ * an entry, removing any entry, or moving an entry whose key changed take logarithmic time.
+ *
+ * `Type` MUST derive from `IndexedHeapEntry` and provide the following method to order the entries (as for
+ * `SortedArray`), which MUST return TRUE if `aFirst < aSecond`:
+ *
+ *    static bool Type::AreInOrder(const Type &aFirst, const Type &aSecond);
+ *
+ * The key of an entry MUST NOT be changed while it is in the heap without calling `DecreaseKey()` or `Update()`.
+ *
+ * @tparam Type      The entry type.
+ * @tparam kMaxSize  Specifies the max heap size (maximum number of entries in the heap).
+ */
+template <typename Type, uint16_t kMaxSize> class IndexedHeap : private NonCopyable
+{
+    static_assert(kMaxSize != 0, "IndexedHeap `kMaxSize` cannot be zero");
+    static_assert(kMaxSize <= 0x7fff, "IndexedHeap `kMaxSize` is too large");
+
+public:
+    /**
+     * Initializes the heap as empty.
+     */
+    IndexedHeap(void)
+        : mLength(0)
+    {
+    }
+
+    /**
+     * Removes all the entries from the heap (in linear time).
+     */
+    void Clear(void)
+    {
+        for (uint16_t index = 0; index < mLength; index++)
+        {
+            mEntries[index]->mHeapIndex = IndexedHeapEntry::kNotInHeap;
+        }
+
+        mLength = 0;
+    }
+
+    /**
+     * Indicates whether or not the heap is empty.
+     *
+     * @retval TRUE   The heap is empty.
+     * @retval FALSE  The heap is not empty.
+     */
+    bool IsEmpty(void) const { return (mLength == 0); }
+
+    /**
+     * Indicates whether or not the heap is full.
+     *
+     * @retval TRUE   The heap is full.
+     * @retval FALSE  The heap is not full.
+     */
+    bool IsFull(void) const { return (mLength == kMaxSize); }
+
+    /**
+     * Returns the maximum heap size (max number of entries).
+     *
+     * @returns The maximum heap size.
+     */
+    uint16_t GetMaxSize(void) const { return kMaxSize; }
+
+    /**
+     * Returns the current number of entries in the heap.
+     *
+     * @returns The number of entries.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * Gets the first entry in the heap (in constant time).
+     *
+     * @returns A pointer to the first entry, or `nullptr` if the heap is empty.
+     */
+    Type *GetTop(void) { return IsEmpty() ? nullptr : mEntries[0]; }
+
+    /**
+     * Gets the first entry in the heap (in constant time).
+     *
+     * @returns A pointer to the first entry, or `nullptr` if the heap is empty.
+     */
+    const Type *GetTop(void) const { return IsEmpty() ? nullptr : mEntries[0]; }
+
+    /**
+     * Indicates whether or not the heap contains a given entry (in constant time).
+     *
+     * @param[in] aEntry  A reference to the entry.
+     *
+     * @retval TRUE   The heap contains @p aEntry.
+     * @retval FALSE  The heap does not contain @p aEntry.
+     */
+    bool Contains(const Type &aEntry) const
+    {
+        uint16_t index = aEntry.mHeapIndex;
+
+        return (index < mLength) && (mEntries[index] == &aEntry);
+    }
+
+    /**
+     * Adds an entry to the heap.
+     *
+     * @param[in] aEntry  A reference to the entry (MUST NOT be in a heap).
+     *
+     * @retval kErrorNone    Successfully added @p aEntry.
+     * @retval kErrorNoBufs  Could not add @p aEntry since the heap is full.
+     */
+    Error Push(Type &aEntry)
+    {
+        Error error = kErrorNone;
+
+        TY_ASSERT(!aEntry.IsInHeap());
+        VerifyOrExit(!IsFull(), error = kErrorNoBufs);
+
+        SiftUp(mLength++, aEntry);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Removes the first entry from the heap.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if the heap is empty.
+     */
+    Type *Pop(void)
+    {
+        Type *entry = GetTop();
+
+        if (entry != nullptr)
+        {
+            Remove(*entry);
+        }
+
+        return entry;
+    }
+
+    /**
+     * Removes an entry from the heap.
+     *
+     * @param[in] aEntry  A reference to the entry (MUST be in the heap).
+     */
+    void Remove(Type &aEntry)
+    {
+        uint16_t index = aEntry.mHeapIndex;
+
+        TY_ASSERT(Contains(aEntry));
+
+        aEntry.mHeapIndex = IndexedHeapEntry::kNotInHeap;
+        mLength--;
+
+        // The last entry fills the position of the removed entry and
+        // is moved up or down from there.
+
+        if (index != mLength)
+        {
+            Move(index, *mEntries[mLength]);
+        }
+    }
+
+    /**
+     * Moves an entry after its key decreased (i.e., it may now be ordered before other entries).
+     *
+     * @param[in] aEntry  A reference to the entry (MUST be in the heap).
+     */
+    void DecreaseKey(Type &aEntry)
+    {
+        TY_ASSERT(Contains(aEntry));
+        SiftUp(aEntry.mHeapIndex, aEntry);
+    }
+
+    /**
+     * Moves an entry after its key changed (increased or decreased).
+     *
+     * @param[in] aEntry  A reference to the entry (MUST be in the heap).
+     */
+    void Update(Type &aEntry)
+    {
+        TY_ASSERT(Contains(aEntry));
+        Move(aEntry.mHeapIndex, aEntry);
+    }
+
+private:
+    static uint16_t GetParent(uint16_t aIndex) { return static_cast<uint16_t>((aIndex - 1) / 2); }
+    static uint16_t GetFirstChild(uint16_t aIndex) { return static_cast<uint16_t>(2 * aIndex + 1); }
+
+    void Place(uint16_t aIndex, Type &aEntry)
+    {
+        mEntries[aIndex]  = &aEntry;
+        aEntry.mHeapIndex = aIndex;
+    }
+
+    // Places `aEntry` at `aIndex` and moves it up or down as needed.
+    void Move(uint16_t aIndex, Type &aEntry)
+    {
+        if ((aIndex > 0) && Type::AreInOrder(aEntry, *mEntries[GetParent(aIndex)]))
+        {
+            SiftUp(aIndex, aEntry);
+        }
+        else
+        {
+            SiftDown(aIndex, aEntry);
+        }
+    }
+
+    // The entries on the path are moved into the hole instead of being
+    // swapped with `aEntry`, which is only placed once.
+
+    void SiftUp(uint16_t aIndex, Type &aEntry)
+    {
+        while (aIndex > 0)
+        {
+            uint16_t parent = GetParent(aIndex);
+
+            if (!Type::AreInOrder(aEntry, *mEntries[parent]))
+            {
+                break;
+            }
+
+            Place(aIndex, *mEntries[parent]);
+            aIndex = parent;
+        }
+
+        Place(aIndex, aEntry);
+    }
+
+    void SiftDown(uint16_t aIndex, Type &aEntry)
+    {
+        uint16_t child;
+
+        while ((child = GetFirstChild(aIndex)) < mLength)
+        {
+            if ((child + 1 < mLength) && Type::AreInOrder(*mEntries[child + 1], *mEntries[child]))
+            {
+                child++;
+            }
+
+            if (!Type::AreInOrder(*mEntries[child], aEntry))
+            {
+                break;
+            }
+
+            Place(aIndex, *mEntries[child]);
+            aIndex = child;
+        }
+
+        Place(aIndex, aEntry);
+    }
+
+    Type    *mEntries[kMaxSize];
+    uint16_t mLength;
+};
+
+} // namespace ty
+
+#endif // INDEXED_HEAP_HPP_
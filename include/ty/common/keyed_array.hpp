@@ -0,0 +1,391 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for an array of elements with keys stored separately (structure of arrays).
+ */
+
+#ifndef KEYED_ARRAY_HPP_
+#define KEYED_ARRAY_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/const_cast.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/locator.hpp"
+#include "ty/common/numeric_limits.hpp"
+#include "ty/common/type_traits.hpp"
+
+namespace ty {
+
+/**
+ * Represents an array of elements with a fixed max size, where the key of each element is stored in a separate array.
+ *
+ * Unlike `Array::FindMatching()`, which calls `Matches()` on each whole element, lookups only scan the contiguous
+ * array of keys, so they touch `sizeof(KeyType)` bytes per element instead of `sizeof(Type)` (e.g., a 2-byte key
+ * instead of a 100-byte entry). The keys are compared in blocks without an early exit, so that the compiler can
+ * vectorize the comparisons for integer keys (e.g., SSE2 on x86, NEON on ARM).
+ *
+ * Elements are found and removed by key, and the key of an element is read with `GetKey()`. A composite key is
+ * packed into a single integer key (e.g., a 16-bit address and an 8-bit type into a `uint32_t`) so that it remains
+ * a single column. Fields which are not used to find elements stay in `Type`.
+ *
+ * All `kMaxSize` keys and elements are constructed along with the array. As in `Array`, removing an element replaces
+ * it with the last element, so the order of the elements can change.
+ *
+ * @tparam KeyType     The key type (an integer type, or any type providing the `==` operator).
+ * @tparam Type        The array element type.
+ * @tparam kMaxSize    Specifies the max array size (maximum number of elements in the array).
+ * @tparam SizeType    The type to be used for array size, length, and index. If not specified, a default `uint` type
+ *                     is determined based on `kMaxSize`, i.e., if `kMaxSize <= 255` then `uint8_t` will be used,
+ *                     otherwise `uint16_t` will be used.
+ */
+template <typename KeyType,
+          typename Type,
+          uint16_t kMaxSize,
+          typename SizeType =
+              typename TypeTraits::Conditional<kMaxSize <= NumericLimits<uint8_t>::kMax, uint8_t, uint16_t>::Type>
+class KeyedArray
+{
+    static_assert(kMaxSize != 0, "KeyedArray `kMaxSize` cannot be zero");
+
+public:
+    /**
+     * Represents the length or index in array.
+     */
+    typedef SizeType IndexType;
+
+    /**
+     * Initializes the array as empty.
+     */
+    KeyedArray(void)
+        : mLength(0)
+    {
+    }
+
+    /**
+     * Initializes the array as empty and initializes its elements by calling `Init(Instance &)` method on every
+     * element.
+     *
+     * @param[in] aInstance  The Tiny instance.
+     */
+    explicit KeyedArray(Instance &aInstance)
+        : mLength(0)
+    {
+        for (Type &element : mElements)
+        {
+            element.Init(aInstance);
+        }
+    }
+
+    /**
+     * Clears the array.
+     */
+    void Clear(void) { mLength = 0; }
+
+    /**
+     * Indicates whether or not the array is empty.
+     *
+     * @retval TRUE when array is empty.
+     * @retval FALSE when array is not empty.
+     */
+    bool IsEmpty(void) const { return (mLength == 0); }
+
+    /**
+     * Indicates whether or not the array is full.
+     *
+     * @retval TRUE when array is full.
+     * @retval FALSE when array is not full.
+     */
+    bool IsFull(void) const { return (mLength == GetMaxSize()); }
+
+    /**
+     * Returns the maximum array size (max number of elements).
+     *
+     * @returns The maximum array size (max number of elements that can be added to the array).
+     */
+    IndexType GetMaxSize(void) const { return static_cast<IndexType>(kMaxSize); }
+
+    /**
+     * Returns the current length of array (number of elements).
+     *
+     * @returns The current array length.
+     */
+    IndexType GetLength(void) const { return mLength; }
+
+    /**
+     * Overloads the `[]` operator to get the element at a given index.
+     *
+     * Does not perform index bounds checking. Behavior is undefined if @p aIndex is not valid.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A reference to the element in array at @p aIndex.
+     */
+    Type &operator[](IndexType aIndex) { return mElements[aIndex]; }
+
+    /**
+     * Overloads the `[]` operator to get the element at a given index.
+     *
+     * Does not perform index bounds checking. Behavior is undefined if @p aIndex is not valid.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A reference to the element in array at @p aIndex.
+     */
+    const Type &operator[](IndexType aIndex) const { return mElements[aIndex]; }
+
+    /**
+     * Gets a pointer to the element at a given index.
+     *
+     * Unlike `operator[]`, this method checks @p aIndex to be valid and within the current length.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A pointer to element in array at @p aIndex or `nullptr` if @p aIndex is not valid.
+     */
+    Type *At(IndexType aIndex) { return (aIndex < mLength) ? &mElements[aIndex] : nullptr; }
+
+    /**
+     * Gets a pointer to the element at a given index.
+     *
+     * Unlike `operator[]`, this method checks @p aIndex to be valid and within the current length.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A pointer to element in array at @p aIndex or `nullptr` if @p aIndex is not valid.
+     */
+    const Type *At(IndexType aIndex) const { return (aIndex < mLength) ? &mElements[aIndex] : nullptr; }
+
+    /**
+     * Returns the key of the element at a given index.
+     *
+     * Does not perform index bounds checking. Behavior is undefined if @p aIndex is not valid.
+     *
+     * @param[in] aIndex  The index of the element.
+     *
+     * @returns The key of the element at @p aIndex.
+     */
+    const KeyType &GetKey(IndexType aIndex) const { return mKeys[aIndex]; }
+
+    /**
+     * Changes the key of the element at a given index.
+     *
+     * Does not perform index bounds checking. Behavior is undefined if @p aIndex is not valid.
+     *
+     * @param[in] aIndex  The index of the element.
+     * @param[in] aKey    The new key.
+     */
+    void SetKey(IndexType aIndex, const KeyType &aKey) { mKeys[aIndex] = aKey; }
+
+    /**
+     * Returns the index of an element in the array.
+     *
+     * The @p aElement MUST be from the array, otherwise the behavior of this method is undefined.
+     *
+     * @param[in] aElement  A reference to an element in the array.
+     *
+     * @returns The index of @p aElement in the array.
+     */
+    IndexType IndexOf(const Type &aElement) const { return static_cast<IndexType>(&aElement - &mElements[0]); }
+
+    /**
+     * Appends a new element with a given key to the end of the array.
+     *
+     * On success, this method returns a pointer to the newly appended element in the array for the caller to
+     * initialize and use.
+     *
+     * @param[in] aKey  The key of the new element.
+     *
+     * @return A pointer to the newly appended element or `nullptr` if array is full.
+     */
+    Type *PushBack(const KeyType &aKey)
+    {
+        Type *element = nullptr;
+
+        VerifyOrExit(!IsFull());
+
+        mKeys[mLength] = aKey;
+        element        = &mElements[mLength++];
+
+    exit:
+        return element;
+    }
+
+    /**
+     * Appends a new element with a given key to the end of the array.
+     *
+     * The method uses assignment `=` operator on `Type` to copy @p aEntry into the added array element.
+     *
+     * @param[in] aKey       The key of the new element.
+     * @param[in] aEntry     The new entry to push back.
+     *
+     * @retval kErrorNone    Successfully pushed back @p aEntry to the end of the array.
+     * @retval kErrorNoBufs  Could not append the new element since array is full.
+     */
+    Error PushBack(const KeyType &aKey, const Type &aEntry)
+    {
+        Type *element = PushBack(aKey);
+
+        return (element != nullptr) ? (*element = aEntry, kErrorNone) : kErrorNoBufs;
+    }
+
+    /**
+     * Finds the index of the first element with a given key.
+     *
+     * @param[in]  aKey    The key to search for.
+     * @param[out] aIndex  A reference to output the index of the element.
+     *
+     * @retval kErrorNone      Successfully found an element with @p aKey.
+     * @retval kErrorNotFound  No element with @p aKey in the array.
+     */
+    Error FindIndex(const KeyType &aKey, IndexType &aIndex) const
+    {
+        aIndex = FindKey(aKey, 0);
+
+        return (aIndex < mLength) ? kErrorNone : kErrorNotFound;
+    }
+
+    /**
+     * Finds the first element with a given key.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @returns A pointer to the matched array element, or `nullptr` if a match could not be found.
+     */
+    Type *Find(const KeyType &aKey) { return AsNonConst(AsConst(this)->Find(aKey)); }
+
+    /**
+     * Finds the first element with a given key.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @returns A pointer to the matched array element, or `nullptr` if a match could not be found.
+     */
+    const Type *Find(const KeyType &aKey) const { return At(FindKey(aKey, 0)); }
+
+    /**
+     * Indicates whether or not the array contains an element with a given key.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @retval TRUE   The array contains an element with @p aKey.
+     * @retval FALSE  The array does not contain an element with @p aKey.
+     */
+    bool Contains(const KeyType &aKey) const { return FindKey(aKey, 0) < mLength; }
+
+    /**
+     * Removes an element from the array.
+     *
+     * The @p aElement MUST be from the array, otherwise the behavior of this method is undefined.
+     *
+     * To remove @p aElement, it is replaced by the last element in array (using move assignment `=` operator on
+     * `Type`), so the order of items in the array can change after a call to this method.
+     *
+     * @param[in] aElement  A reference to the element to remove.
+     */
+    void Remove(Type &aElement) { RemoveAt(IndexOf(aElement)); }
+
+    /**
+     * Removes the first element with a given key.
+     *
+     * Behaves similar to `Remove()`, i.e., the matched element (if found) is replaced with the last element in the
+     * array.
+     *
+     * @param[in] aKey   The key to search for.
+     */
+    void RemoveMatching(const KeyType &aKey)
+    {
+        IndexType index = FindKey(aKey, 0);
+
+        if (index < mLength)
+        {
+            RemoveAt(index);
+        }
+    }
+
+    /**
+     * Removes all elements with a given key.
+     *
+     * Behaves similar to `Remove()`, i.e., a matched element is replaced with the last element in the array.
+     *
+     * @param[in] aKey   The key to search for.
+     */
+    void RemoveAllMatching(const KeyType &aKey)
+    {
+        // When an element is removed it is replaced with the last
+        // element, so the search resumes from the same index.
+
+        for (IndexType index = FindKey(aKey, 0); index < mLength; index = FindKey(aKey, index))
+        {
+            RemoveAt(index);
+        }
+    }
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the array elements and should not be used
+    // directly.
+
+    Type       *begin(void) { return &mElements[0]; }
+    Type       *end(void) { return &mElements[mLength]; }
+    const Type *begin(void) const { return &mElements[0]; }
+    const Type *end(void) const { return &mElements[mLength]; }
+
+private:
+    // Number of keys compared per block, 32 bytes of keys (one or two
+    // vector registers).
+    static constexpr uint16_t kKeysPerBlock = (sizeof(KeyType) < 32) ? (32 / sizeof(KeyType)) : 1;
+
+    // Returns the index of the first key matching `aKey` from
+    // `aStart`, or `mLength` if there is none.
+    IndexType FindKey(const KeyType &aKey, IndexType aStart) const
+    {
+        uint16_t index = aStart;
+
+        while (mLength - index >= kKeysPerBlock)
+        {
+            const KeyType *keys  = &mKeys[index];
+            uint8_t        found = 0;
+
+            for (uint16_t offset = 0; offset < kKeysPerBlock; offset++)
+            {
+                found |= static_cast<uint8_t>(keys[offset] == aKey);
+            }
+
+            if (found)
+            {
+                break;
+            }
+
+            index += kKeysPerBlock;
+        }
+
+        while ((index < mLength) && !(mKeys[index] == aKey))
+        {
+            index++;
+        }
+
+        return static_cast<IndexType>(index);
+    }
+
+    void RemoveAt(IndexType aIndex)
+    {
+        mLength--;
+
+        if (aIndex != mLength)
+        {
+            mKeys[aIndex]     = Move(mKeys[mLength]);
+            mElements[aIndex] = Move(mElements[mLength]);
+        }
+    }
+
+    KeyType   mKeys[kMaxSize];
+    Type      mElements[kMaxSize];
+    IndexType mLength;
+};
+
+} // namespace ty
+
+#endif // KEYED_ARRAY_HPP_
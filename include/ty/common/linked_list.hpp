@@ -0,0 +1,890 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for intrusive singly and doubly linked lists.
+ */
+
+#ifndef LINKED_LIST_HPP_
+#define LINKED_LIST_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/const_cast.hpp"
+#include "ty/common/debug.hpp"
+#include "ty/common/error.hpp"
+
+namespace ty {
+
+/**
+ * Represents an iterator over the entries of a `LinkedList` or a `DoublyLinkedList`.
+ *
+ * The entries are visited from the head of the list. Removing the current entry from the list invalidates the
+ * iterator (the other entries can be removed).
+ *
+ * @tparam EntryType  The entry type (`Type` or `const Type`).
+ */
+template <typename EntryType> class LinkedListIterator
+{
+public:
+    /**
+     * Initializes the iterator to point to a given entry.
+     *
+     * @param[in] aEntry  A pointer to the entry, or `nullptr` for the end of the list.
+     */
+    explicit LinkedListIterator(EntryType *aEntry)
+        : mEntry(aEntry)
+    {
+    }
+
+    /**
+     * Overloads the `*` dereference operator and gets a reference to the entry the iterator is pointing to.
+     *
+     * @returns A reference to the entry.
+     */
+    EntryType &operator*(void) const { return *mEntry; }
+
+    /**
+     * Overloads the `->` dereference operator and gets a pointer to the entry the iterator is pointing to.
+     *
+     * @returns A pointer to the entry.
+     */
+    EntryType *operator->(void) const { return mEntry; }
+
+    /**
+     * Overloads the `++` operator (pre-increment) to move the iterator to the next entry.
+     *
+     * @returns A reference to the iterator.
+     */
+    LinkedListIterator &operator++(void)
+    {
+        mEntry = mEntry->GetNext();
+        return *this;
+    }
+
+    /**
+     * Overloads the `==` operator to evaluate whether two iterators are equal.
+     *
+     * @param[in] aOther  The other iterator to compare with.
+     *
+     * @retval TRUE   The iterators are equal.
+     * @retval FALSE  The iterators are not equal.
+     */
+    bool operator==(const LinkedListIterator &aOther) const { return (mEntry == aOther.mEntry); }
+
+    /**
+     * Overloads the `!=` operator to evaluate whether two iterators are unequal.
+     *
+     * @param[in] aOther  The other iterator to compare with.
+     *
+     * @retval TRUE   The iterators are not equal.
+     * @retval FALSE  The iterators are equal.
+     */
+    bool operator!=(const LinkedListIterator &aOther) const { return !(*this == aOther); }
+
+private:
+    EntryType *mEntry;
+};
+
+/**
+ * Represents a linked list entry.
+ *
+ * `Type` MUST derive from `LinkedListEntry<Type>` and provide a `Type *mNext` member (which can be private, with
+ * `LinkedListEntry<Type>` declared as a friend).
+ *
+ * @tparam Type  The entry type.
+ */
+template <typename Type> class LinkedListEntry
+{
+public:
+    /**
+     * Gets the next entry in the list.
+     *
+     * @returns A pointer to the next entry, or `nullptr` if it is the last entry.
+     */
+    Type *GetNext(void) { return static_cast<Type *>(this)->mNext; }
+
+    /**
+     * Gets the next entry in the list.
+     *
+     * @returns A pointer to the next entry, or `nullptr` if it is the last entry.
+     */
+    const Type *GetNext(void) const { return static_cast<const Type *>(this)->mNext; }
+
+    /**
+     * Sets the next entry in the list.
+     *
+     * @param[in] aNext  A pointer to the next entry, or `nullptr`.
+     */
+    void SetNext(Type *aNext) { static_cast<Type *>(this)->mNext = aNext; }
+};
+
+/**
+ * Represents an intrusive singly linked list.
+ *
+ * The list does not own nor allocate its entries: the link to the next entry is in the entry itself (see
+ * `LinkedListEntry`), so an entry can only be in one list (using a given link) at a time. Adding or removing an entry
+ * at the head takes constant time, and removing an entry from elsewhere takes linear time (see `DoublyLinkedList` for
+ * constant time).
+ *
+ * @tparam Type  The entry type (MUST derive from `LinkedListEntry<Type>`).
+ */
+template <typename Type> class LinkedList
+{
+public:
+    typedef LinkedListIterator<Type>       Iterator;      ///< The iterator type.
+    typedef LinkedListIterator<const Type> ConstIterator; ///< The const iterator type.
+
+    /**
+     * Initializes the list as empty.
+     */
+    LinkedList(void)
+        : mHead(nullptr)
+    {
+    }
+
+    /**
+     * Gets the head of the list.
+     *
+     * @returns A pointer to the head entry, or `nullptr` if the list is empty.
+     */
+    Type *GetHead(void) { return mHead; }
+
+    /**
+     * Gets the head of the list.
+     *
+     * @returns A pointer to the head entry, or `nullptr` if the list is empty.
+     */
+    const Type *GetHead(void) const { return mHead; }
+
+    /**
+     * Sets the head of the list (replacing all the entries with those linked from @p aHead).
+     *
+     * @param[in] aHead  A pointer to the new head entry, or `nullptr` to make the list empty.
+     */
+    void SetHead(Type *aHead) { mHead = aHead; }
+
+    /**
+     * Gets the tail of the list (in linear time).
+     *
+     * @returns A pointer to the tail entry, or `nullptr` if the list is empty.
+     */
+    Type *GetTail(void) { return AsNonConst(AsConst(this)->GetTail()); }
+
+    /**
+     * Gets the tail of the list (in linear time).
+     *
+     * @returns A pointer to the tail entry, or `nullptr` if the list is empty.
+     */
+    const Type *GetTail(void) const
+    {
+        const Type *tail = mHead;
+
+        if (tail != nullptr)
+        {
+            while (tail->GetNext() != nullptr)
+            {
+                tail = tail->GetNext();
+            }
+        }
+
+        return tail;
+    }
+
+    /**
+     * Clears the list (the entries are not changed).
+     */
+    void Clear(void) { mHead = nullptr; }
+
+    /**
+     * Indicates whether or not the list is empty.
+     *
+     * @retval TRUE   The list is empty.
+     * @retval FALSE  The list is not empty.
+     */
+    bool IsEmpty(void) const { return (mHead == nullptr); }
+
+    /**
+     * Adds an entry at the head of the list.
+     *
+     * @param[in] aEntry  A reference to the entry (MUST NOT be in the list).
+     */
+    void Push(Type &aEntry)
+    {
+        aEntry.SetNext(mHead);
+        mHead = &aEntry;
+    }
+
+    /**
+     * Adds an entry after a given entry in the list.
+     *
+     * @param[in] aEntry      A reference to the entry to add (MUST NOT be in the list).
+     * @param[in] aPrevEntry  A reference to the entry after which to add @p aEntry (MUST be in the list).
+     */
+    void PushAfter(Type &aEntry, Type &aPrevEntry)
+    {
+        aEntry.SetNext(aPrevEntry.GetNext());
+        aPrevEntry.SetNext(&aEntry);
+    }
+
+    /**
+     * Removes the entry at the head of the list.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if the list is empty.
+     */
+    Type *Pop(void)
+    {
+        Type *entry = mHead;
+
+        if (entry != nullptr)
+        {
+            mHead = entry->GetNext();
+        }
+
+        return entry;
+    }
+
+    /**
+     * Removes the entry after a given entry in the list.
+     *
+     * @param[in] aPrevEntry  A pointer to the entry before the one to remove (MUST be in the list), or `nullptr` to
+     *                        remove the head.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if there is none.
+     */
+    Type *PopAfter(Type *aPrevEntry)
+    {
+        Type *entry;
+
+        VerifyOrExit(aPrevEntry != nullptr, entry = Pop());
+
+        entry = aPrevEntry->GetNext();
+
+        if (entry != nullptr)
+        {
+            aPrevEntry->SetNext(entry->GetNext());
+        }
+
+    exit:
+        return entry;
+    }
+
+    /**
+     * Indicates whether or not the list contains a given entry (in linear time).
+     *
+     * @param[in] aEntry  A reference to the entry.
+     *
+     * @retval TRUE   The list contains @p aEntry.
+     * @retval FALSE  The list does not contain @p aEntry.
+     */
+    bool Contains(const Type &aEntry) const
+    {
+        const Type *prev;
+
+        return (Find(aEntry, prev) == kErrorNone);
+    }
+
+    /**
+     * Removes an entry from the list (in linear time).
+     *
+     * @param[in] aEntry  A reference to the entry.
+     *
+     * @retval kErrorNone      Successfully removed @p aEntry.
+     * @retval kErrorNotFound  @p aEntry is not in the list.
+     */
+    Error Remove(const Type &aEntry)
+    {
+        Error error;
+        Type *prev;
+
+        SuccessOrExit(error = Find(aEntry, prev));
+        IgnoreReturnValue(PopAfter(prev));
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Finds an entry in the list and the entry before it.
+     *
+     * @param[in]  aEntry      A reference to the entry.
+     * @param[out] aPrevEntry  A reference to output a pointer to the entry before @p aEntry (`nullptr` if it is the
+     *                         head).
+     *
+     * @retval kErrorNone      Successfully found @p aEntry.
+     * @retval kErrorNotFound  @p aEntry is not in the list.
+     */
+    Error Find(const Type &aEntry, Type *&aPrevEntry)
+    {
+        const Type *prev;
+        Error       error = AsConst(this)->Find(aEntry, prev);
+
+        aPrevEntry = AsNonConst(prev);
+
+        return error;
+    }
+
+    /**
+     * Finds an entry in the list and the entry before it.
+     *
+     * @param[in]  aEntry      A reference to the entry.
+     * @param[out] aPrevEntry  A reference to output a pointer to the entry before @p aEntry (`nullptr` if it is the
+     *                         head).
+     *
+     * @retval kErrorNone      Successfully found @p aEntry.
+     * @retval kErrorNotFound  @p aEntry is not in the list.
+     */
+    Error Find(const Type &aEntry, const Type *&aPrevEntry) const
+    {
+        Error error = kErrorNotFound;
+
+        aPrevEntry = nullptr;
+
+        for (const Type *entry = mHead; entry != nullptr; aPrevEntry = entry, entry = entry->GetNext())
+        {
+            if (entry == &aEntry)
+            {
+                error = kErrorNone;
+                break;
+            }
+        }
+
+        return error;
+    }
+
+    /**
+     * Finds the first entry matching a given indicator.
+     *
+     * The `Matches()` method is invoked on each entry, and MUST be provided by `Type` accordingly:
+     *
+     *     bool Type::Matches(const Indicator &aIndicator) const
+     *
+     * @param[in]  aIndicator  An indicator to match with the entries.
+     * @param[out] aPrevEntry  A reference to output a pointer to the entry before the matched one (`nullptr` if it is
+     *                         the head or if there is no match).
+     *
+     * @returns A pointer to the matched entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator> Type *FindMatching(const Indicator &aIndicator, Type *&aPrevEntry)
+    {
+        const Type *prev;
+        const Type *entry = AsConst(this)->FindMatching(aIndicator, prev);
+
+        aPrevEntry = AsNonConst(prev);
+
+        return AsNonConst(entry);
+    }
+
+    /**
+     * Finds the first entry matching a given indicator.
+     *
+     * @param[in]  aIndicator  An indicator to match with the entries.
+     * @param[out] aPrevEntry  A reference to output a pointer to the entry before the matched one (`nullptr` if it is
+     *                         the head or if there is no match).
+     *
+     * @returns A pointer to the matched entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator>
+    const Type *FindMatching(const Indicator &aIndicator, const Type *&aPrevEntry) const
+    {
+        const Type *entry;
+
+        aPrevEntry = nullptr;
+
+        for (entry = mHead; entry != nullptr; aPrevEntry = entry, entry = entry->GetNext())
+        {
+            if (entry->Matches(aIndicator))
+            {
+                break;
+            }
+        }
+
+        if (entry == nullptr)
+        {
+            aPrevEntry = nullptr;
+        }
+
+        return entry;
+    }
+
+    /**
+     * Finds the first entry matching a given indicator.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @returns A pointer to the matched entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator> Type *FindMatching(const Indicator &aIndicator)
+    {
+        return AsNonConst(AsConst(this)->FindMatching(aIndicator));
+    }
+
+    /**
+     * Finds the first entry matching a given indicator.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @returns A pointer to the matched entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator> const Type *FindMatching(const Indicator &aIndicator) const
+    {
+        const Type *prev;
+
+        return FindMatching(aIndicator, prev);
+    }
+
+    /**
+     * Indicates whether or not the list contains an entry matching a given indicator.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @retval TRUE   The list contains a matching entry.
+     * @retval FALSE  The list does not contain a matching entry.
+     */
+    template <typename Indicator> bool ContainsMatching(const Indicator &aIndicator) const
+    {
+        return (FindMatching(aIndicator) != nullptr);
+    }
+
+    /**
+     * Removes the first entry matching a given indicator.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator> Type *RemoveMatching(const Indicator &aIndicator)
+    {
+        Type *prev;
+        Type *entry = FindMatching(aIndicator, prev);
+
+        if (entry != nullptr)
+        {
+            IgnoreReturnValue(PopAfter(prev));
+        }
+
+        return entry;
+    }
+
+    /**
+     * Removes all the entries matching a given indicator and adds them to another list.
+     *
+     * The removed entries are added at the head of @p aRemovedList, so their order is reversed.
+     *
+     * @param[in] aIndicator    An indicator to match with the entries.
+     * @param[in] aRemovedList  The list to add the removed entries to.
+     */
+    template <typename Indicator> void RemoveAllMatching(const Indicator &aIndicator, LinkedList &aRemovedList)
+    {
+        Type *prev = nullptr;
+        Type *next;
+
+        for (Type *entry = mHead; entry != nullptr; entry = next)
+        {
+            next = entry->GetNext();
+
+            if (entry->Matches(aIndicator))
+            {
+                IgnoreReturnValue(PopAfter(prev));
+                aRemovedList.Push(*entry);
+            }
+            else
+            {
+                prev = entry;
+            }
+        }
+    }
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the list entries and should not be used
+    // directly.
+
+    Iterator      begin(void) { return Iterator(mHead); }
+    Iterator      end(void) { return Iterator(nullptr); }
+    ConstIterator begin(void) const { return ConstIterator(mHead); }
+    ConstIterator end(void) const { return ConstIterator(nullptr); }
+
+private:
+    Type *mHead;
+};
+
+/**
+ * Represents a doubly linked list entry.
+ *
+ * `Type` MUST derive from `DoublyLinkedListEntry<Type>` and provide `Type *mNext` and `Type *mPrev` members (which can
+ * be private, with `DoublyLinkedListEntry<Type>` declared as a friend).
+ *
+ * @tparam Type  The entry type.
+ */
+template <typename Type> class DoublyLinkedListEntry
+{
+public:
+    /**
+     * Gets the next entry in the list.
+     *
+     * @returns A pointer to the next entry, or `nullptr` if it is the last entry.
+     */
+    Type *GetNext(void) { return static_cast<Type *>(this)->mNext; }
+
+    /**
+     * Gets the next entry in the list.
+     *
+     * @returns A pointer to the next entry, or `nullptr` if it is the last entry.
+     */
+    const Type *GetNext(void) const { return static_cast<const Type *>(this)->mNext; }
+
+    /**
+     * Gets the previous entry in the list.
+     *
+     * @returns A pointer to the previous entry, or `nullptr` if it is the first entry.
+     */
+    Type *GetPrev(void) { return static_cast<Type *>(this)->mPrev; }
+
+    /**
+     * Gets the previous entry in the list.
+     *
+     * @returns A pointer to the previous entry, or `nullptr` if it is the first entry.
+     */
+    const Type *GetPrev(void) const { return static_cast<const Type *>(this)->mPrev; }
+
+    /**
+     * Sets the next entry in the list.
+     *
+     * @param[in] aNext  A pointer to the next entry, or `nullptr`.
+     */
+    void SetNext(Type *aNext) { static_cast<Type *>(this)->mNext = aNext; }
+
+    /**
+     * Sets the previous entry in the list.
+     *
+     * @param[in] aPrev  A pointer to the previous entry, or `nullptr`.
+     */
+    void SetPrev(Type *aPrev) { static_cast<Type *>(this)->mPrev = aPrev; }
+};
+
+/**
+ * Represents an intrusive doubly linked list.
+ *
+ * As in `LinkedList`, the links are in the entries themselves (see `DoublyLinkedListEntry`). Adding or removing an
+ * entry anywhere in the list (e.g., cancelling a pending request or a retransmission) takes constant time, and the
+ * list keeps its tail to add entries at the end in constant time.
+ *
+ * @tparam Type  The entry type (MUST derive from `DoublyLinkedListEntry<Type>`).
+ */
+template <typename Type> class DoublyLinkedList
+{
+public:
+    typedef LinkedListIterator<Type>       Iterator;      ///< The iterator type.
+    typedef LinkedListIterator<const Type> ConstIterator; ///< The const iterator type.
+
+    /**
+     * Initializes the list as empty.
+     */
+    DoublyLinkedList(void)
+        : mHead(nullptr)
+        , mTail(nullptr)
+    {
+    }
+
+    /**
+     * Gets the head of the list.
+     *
+     * @returns A pointer to the head entry, or `nullptr` if the list is empty.
+     */
+    Type *GetHead(void) { return mHead; }
+
+    /**
+     * Gets the head of the list.
+     *
+     * @returns A pointer to the head entry, or `nullptr` if the list is empty.
+     */
+    const Type *GetHead(void) const { return mHead; }
+
+    /**
+     * Gets the tail of the list.
+     *
+     * @returns A pointer to the tail entry, or `nullptr` if the list is empty.
+     */
+    Type *GetTail(void) { return mTail; }
+
+    /**
+     * Gets the tail of the list.
+     *
+     * @returns A pointer to the tail entry, or `nullptr` if the list is empty.
+     */
+    const Type *GetTail(void) const { return mTail; }
+
+    /**
+     * Clears the list (the entries are not changed).
+     */
+    void Clear(void)
+    {
+        mHead = nullptr;
+        mTail = nullptr;
+    }
+
+    /**
+     * Indicates whether or not the list is empty.
+     *
+     * @retval TRUE   The list is empty.
+     * @retval FALSE  The list is not empty.
+     */
+    bool IsEmpty(void) const { return (mHead == nullptr); }
+
+    /**
+     * Adds an entry at the head of the list.
+     *
+     * @param[in] aEntry  A reference to the entry (MUST NOT be in the list).
+     */
+    void Push(Type &aEntry) { Insert(aEntry, nullptr, mHead); }
+
+    /**
+     * Adds an entry at the tail of the list.
+     *
+     * @param[in] aEntry  A reference to the entry (MUST NOT be in the list).
+     */
+    void PushBack(Type &aEntry) { Insert(aEntry, mTail, nullptr); }
+
+    /**
+     * Adds an entry after a given entry in the list.
+     *
+     * @param[in] aEntry      A reference to the entry to add (MUST NOT be in the list).
+     * @param[in] aPrevEntry  A reference to the entry after which to add @p aEntry (MUST be in the list).
+     */
+    void PushAfter(Type &aEntry, Type &aPrevEntry) { Insert(aEntry, &aPrevEntry, aPrevEntry.GetNext()); }
+
+    /**
+     * Adds an entry before a given entry in the list.
+     *
+     * @param[in] aEntry      A reference to the entry to add (MUST NOT be in the list).
+     * @param[in] aNextEntry  A reference to the entry before which to add @p aEntry (MUST be in the list).
+     */
+    void PushBefore(Type &aEntry, Type &aNextEntry) { Insert(aEntry, aNextEntry.GetPrev(), &aNextEntry); }
+
+    /**
+     * Removes the entry at the head of the list.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if the list is empty.
+     */
+    Type *Pop(void)
+    {
+        Type *entry = mHead;
+
+        if (entry != nullptr)
+        {
+            Remove(*entry);
+        }
+
+        return entry;
+    }
+
+    /**
+     * Removes the entry at the tail of the list.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if the list is empty.
+     */
+    Type *PopBack(void)
+    {
+        Type *entry = mTail;
+
+        if (entry != nullptr)
+        {
+            Remove(*entry);
+        }
+
+        return entry;
+    }
+
+    /**
+     * Removes an entry from the list (in constant time).
+     *
+     * The links of the removed entry are set to `nullptr`.
+     *
+     * @param[in] aEntry  A reference to the entry (MUST be in the list).
+     */
+    void Remove(Type &aEntry)
+    {
+        Type *prev = aEntry.GetPrev();
+        Type *next = aEntry.GetNext();
+
+        TY_ASSERT((prev != nullptr) ? (prev->GetNext() == &aEntry) : (mHead == &aEntry));
+        TY_ASSERT((next != nullptr) ? (next->GetPrev() == &aEntry) : (mTail == &aEntry));
+
+        if (prev != nullptr)
+        {
+            prev->SetNext(next);
+        }
+        else
+        {
+            mHead = next;
+        }
+
+        if (next != nullptr)
+        {
+            next->SetPrev(prev);
+        }
+        else
+        {
+            mTail = prev;
+        }
+
+        aEntry.SetNext(nullptr);
+        aEntry.SetPrev(nullptr);
+    }
+
+    /**
+     * Indicates whether or not the list contains a given entry (in linear time).
+     *
+     * @param[in] aEntry  A reference to the entry.
+     *
+     * @retval TRUE   The list contains @p aEntry.
+     * @retval FALSE  The list does not contain @p aEntry.
+     */
+    bool Contains(const Type &aEntry) const
+    {
+        const Type *entry = mHead;
+
+        while ((entry != nullptr) && (entry != &aEntry))
+        {
+            entry = entry->GetNext();
+        }
+
+        return (entry != nullptr);
+    }
+
+    /**
+     * Finds the first entry matching a given indicator.
+     *
+     * The `Matches()` method is invoked on each entry, and MUST be provided by `Type` accordingly:
+     *
+     *     bool Type::Matches(const Indicator &aIndicator) const
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @returns A pointer to the matched entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator> Type *FindMatching(const Indicator &aIndicator)
+    {
+        return AsNonConst(AsConst(this)->FindMatching(aIndicator));
+    }
+
+    /**
+     * Finds the first entry matching a given indicator.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @returns A pointer to the matched entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator> const Type *FindMatching(const Indicator &aIndicator) const
+    {
+        const Type *entry = mHead;
+
+        while ((entry != nullptr) && !entry->Matches(aIndicator))
+        {
+            entry = entry->GetNext();
+        }
+
+        return entry;
+    }
+
+    /**
+     * Indicates whether or not the list contains an entry matching a given indicator.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @retval TRUE   The list contains a matching entry.
+     * @retval FALSE  The list does not contain a matching entry.
+     */
+    template <typename Indicator> bool ContainsMatching(const Indicator &aIndicator) const
+    {
+        return (FindMatching(aIndicator) != nullptr);
+    }
+
+    /**
+     * Removes the first entry matching a given indicator.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @returns A pointer to the removed entry, or `nullptr` if there is no match.
+     */
+    template <typename Indicator> Type *RemoveMatching(const Indicator &aIndicator)
+    {
+        Type *entry = FindMatching(aIndicator);
+
+        if (entry != nullptr)
+        {
+            Remove(*entry);
+        }
+
+        return entry;
+    }
+
+    /**
+     * Removes all the entries matching a given indicator and adds them to another list.
+     *
+     * The removed entries are added at the tail of @p aRemovedList, so their order is kept.
+     *
+     * @param[in] aIndicator    An indicator to match with the entries.
+     * @param[in] aRemovedList  The list to add the removed entries to.
+     */
+    template <typename Indicator> void RemoveAllMatching(const Indicator &aIndicator, DoublyLinkedList &aRemovedList)
+    {
+        Type *next;
+
+        for (Type *entry = mHead; entry != nullptr; entry = next)
+        {
+            next = entry->GetNext();
+
+            if (entry->Matches(aIndicator))
+            {
+                Remove(*entry);
+                aRemovedList.PushBack(*entry);
+            }
+        }
+    }
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the list entries and should not be used
+    // directly.
+
+    Iterator      begin(void) { return Iterator(mHead); }
+    Iterator      end(void) { return Iterator(nullptr); }
+    ConstIterator begin(void) const { return ConstIterator(mHead); }
+    ConstIterator end(void) const { return ConstIterator(nullptr); }
+
+private:
+    void Insert(Type &aEntry, Type *aPrev, Type *aNext)
+    {
+        aEntry.SetPrev(aPrev);
+        aEntry.SetNext(aNext);
+
+        if (aPrev != nullptr)
+        {
+            aPrev->SetNext(&aEntry);
+        }
+        else
+        {
+            mHead = &aEntry;
+        }
+
+        if (aNext != nullptr)
+        {
+            aNext->SetPrev(&aEntry);
+        }
+        else
+        {
+            mTail = &aEntry;
+        }
+    }
+
+    Type *mHead;
+    Type *mTail;
+};
+
+} // namespace ty
+
+#endif // LINKED_LIST_HPP_
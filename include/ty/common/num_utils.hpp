@@ -220,6 +220,8 @@ inline unsigned long ToUlong(uint32_t aUint32)
 /**
  * Counts the number of `1` bits in the binary representation of a given unsigned int bit-mask value.
  *
+ * Uses the population-count instruction of the processor where the toolchain provides it.
+ *
  * @tparam UintType   The unsigned int type (MUST be `uint8_t`, uint16_t`, uint32_t`, or `uint64_t`).
  *
  * @param[in] aMask   A bit mask.
@@ -232,6 +234,10 @@ template <typename UintType> uint8_t CountBitsInMask(UintType aMask)
                       TypeTraits::IsSame<UintType, uint32_t>::kValue || TypeTraits::IsSame<UintType, uint64_t>::kValue,
                   "UintType must be `uint8_t`, `uint16_t`, `uint32_t`, or `uint64_t`");
 
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint8_t>((sizeof(UintType) <= sizeof(unsigned int)) ? __builtin_popcount(aMask)
+                                                                           : __builtin_popcountll(aMask));
+#else
     uint8_t count = 0;
 
     while (aMask != 0)
@@ -241,6 +247,80 @@ template <typename UintType> uint8_t CountBitsInMask(UintType aMask)
     }
 
     return count;
+#endif
+}
+
+/**
+ * Counts the number of trailing `0` bits (below the least significant `1` bit) in a given unsigned int bit-mask value.
+ *
+ * Uses the bit-scan instruction of the processor where the toolchain provides it.
+ *
+ * @tparam UintType   The unsigned int type (MUST be `uint8_t`, uint16_t`, uint32_t`, or `uint64_t`).
+ *
+ * @param[in] aMask   A bit mask (MUST NOT be zero).
+ *
+ * @returns The number of trailing `0` bits in @p aMask, i.e., the index of its least significant `1` bit.
+ */
+template <typename UintType> uint8_t CountTrailingZeros(UintType aMask)
+{
+    static_assert(TypeTraits::IsSame<UintType, uint8_t>::kValue || TypeTraits::IsSame<UintType, uint16_t>::kValue ||
+                      TypeTraits::IsSame<UintType, uint32_t>::kValue || TypeTraits::IsSame<UintType, uint64_t>::kValue,
+                  "UintType must be `uint8_t`, `uint16_t`, `uint32_t`, or `uint64_t`");
+
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint8_t>((sizeof(UintType) <= sizeof(unsigned int)) ? __builtin_ctz(aMask)
+                                                                           : __builtin_ctzll(aMask));
+#else
+    uint8_t count = 0;
+
+    while ((aMask & 1) == 0)
+    {
+        aMask >>= 1;
+        count++;
+    }
+
+    return count;
+#endif
+}
+
+/**
+ * Counts the number of leading `0` bits (above the most significant `1` bit) in a given unsigned int bit-mask value.
+ *
+ * Uses the bit-scan instruction of the processor where the toolchain provides it.
+ *
+ * @tparam UintType   The unsigned int type (MUST be `uint8_t`, uint16_t`, uint32_t`, or `uint64_t`).
+ *
+ * @param[in] aMask   A bit mask (MUST NOT be zero).
+ *
+ * @returns The number of leading `0` bits in @p aMask (counted within the width of `UintType`).
+ */
+template <typename UintType> uint8_t CountLeadingZeros(UintType aMask)
+{
+    static_assert(TypeTraits::IsSame<UintType, uint8_t>::kValue || TypeTraits::IsSame<UintType, uint16_t>::kValue ||
+                      TypeTraits::IsSame<UintType, uint32_t>::kValue || TypeTraits::IsSame<UintType, uint64_t>::kValue,
+                  "UintType must be `uint8_t`, `uint16_t`, `uint32_t`, or `uint64_t`");
+
+    static constexpr uint8_t kNumBits = sizeof(UintType) * 8;
+
+#if defined(__GNUC__) || defined(__clang__)
+    // The builtins count within the width of `unsigned int` or
+    // `unsigned long long`, so the extra leading bits of the
+    // (zero-extended) narrower types are subtracted.
+
+    return static_cast<uint8_t>((sizeof(UintType) <= sizeof(unsigned int))
+                                    ? __builtin_clz(aMask) - (sizeof(unsigned int) * 8 - kNumBits)
+                                    : __builtin_clzll(aMask) - (sizeof(unsigned long long) * 8 - kNumBits));
+#else
+    uint8_t count = 0;
+
+    while ((aMask & (static_cast<UintType>(1) << (kNumBits - 1))) == 0)
+    {
+        aMask <<= 1;
+        count++;
+    }
+
+    return count;
+#endif
 }
 
 } // namespace ty
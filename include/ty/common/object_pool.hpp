@@ -0,0 +1,339 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for a pool of typed objects.
+ */
+
+#ifndef TY_OBJECT_POOL_HPP_
+#define TY_OBJECT_POOL_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ty/common/bitset.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/debug.hpp"
+#include "ty/common/locator.hpp"
+#include "ty/common/new.hpp"
+#include "ty/common/non_copyable.hpp"
+#include "ty/common/type_traits.hpp"
+
+namespace ty {
+
+/**
+ * Implements a pool of objects of a given type in static storage.
+ *
+ * Objects are constructed in a free slot of the pool when allocated (using placement new) and destroyed when freed,
+ * both in constant time. The free slots are linked in a free list through their unused storage, so the most recently
+ * freed slot is reused first (while it is likely still in cache). The allocated slots are tracked in a `Bitset`, which
+ * allows iterating over the allocated objects (e.g., with a range-based `for` loop).
+ *
+ * If `Type` derives from `InstanceLocatorInit`, the pool MUST be initialized with the instance, and `Init(Instance &)`
+ * (which `Type` MUST provide, as for `Array(Instance &)`) is called on each object after it is constructed.
+ *
+ * @note `ObjectPool` is not thread-safe.
+ *
+ * @tparam Type   The object type.
+ * @tparam kSize  The number of objects in the pool.
+ */
+template <typename Type, uint16_t kSize> class ObjectPool : private NonCopyable
+{
+    static_assert(kSize > 0, "ObjectPool `kSize` cannot be zero");
+    static_assert(kSize < 0xffff, "ObjectPool `kSize` is too large");
+
+public:
+    /**
+     * Represents an iterator over the allocated objects in the pool.
+     *
+     * The objects are visited in the order of their slots. Allocating or freeing objects invalidates the iterators.
+     *
+     * @tparam ObjectType  The object type (`Type` or `const Type`).
+     * @tparam PoolType    The pool type (`ObjectPool` or `const ObjectPool`).
+     */
+    template <typename ObjectType, typename PoolType> class IteratorBase
+    {
+        friend class ObjectPool;
+
+    public:
+        /**
+         * Overloads the `*` dereference operator and gets a reference to the object the iterator is pointing to.
+         *
+         * @returns A reference to the object.
+         */
+        ObjectType &operator*(void) const { return *mPool->GetObject(*mBit); }
+
+        /**
+         * Overloads the `->` dereference operator and gets a pointer to the object the iterator is pointing to.
+         *
+         * @returns A pointer to the object.
+         */
+        ObjectType *operator->(void) const { return mPool->GetObject(*mBit); }
+
+        /**
+         * Overloads the `++` operator (pre-increment) to move the iterator to the next allocated object.
+         *
+         * @returns A reference to the iterator.
+         */
+        IteratorBase &operator++(void)
+        {
+            ++mBit;
+            return *this;
+        }
+
+        /**
+         * Overloads the `==` operator to evaluate whether two iterators are equal.
+         *
+         * @param[in] aOther  The other iterator to compare with.
+         *
+         * @retval TRUE   The iterators are equal.
+         * @retval FALSE  The iterators are not equal.
+         */
+        bool operator==(const IteratorBase &aOther) const { return (mBit == aOther.mBit); }
+
+        /**
+         * Overloads the `!=` operator to evaluate whether two iterators are unequal.
+         *
+         * @param[in] aOther  The other iterator to compare with.
+         *
+         * @retval TRUE   The iterators are not equal.
+         * @retval FALSE  The iterators are equal.
+         */
+        bool operator!=(const IteratorBase &aOther) const { return !(*this == aOther); }
+
+    private:
+        IteratorBase(PoolType &aPool, typename Bitset<kSize>::Iterator aBit)
+            : mPool(&aPool)
+            , mBit(aBit)
+        {
+        }
+
+        PoolType                        *mPool;
+        typename Bitset<kSize>::Iterator mBit;
+    };
+
+    typedef IteratorBase<Type, ObjectPool>             Iterator;      ///< The iterator type.
+    typedef IteratorBase<const Type, const ObjectPool> ConstIterator; ///< The const iterator type.
+
+    /**
+     * Initializes the pool with all the objects free.
+     */
+    ObjectPool(void)
+        : mInstance(nullptr)
+    {
+        static_assert(!TypeTraits::IsBaseOf<InstanceLocatorInit, Type>::kValue,
+                      "ObjectPool of `InstanceLocatorInit` objects must be initialized with the instance");
+        FreeAll();
+    }
+
+    /**
+     * Initializes the pool with all the objects free, for objects which are initialized with the instance.
+     *
+     * @param[in] aInstance  The Tiny instance.
+     */
+    explicit ObjectPool(Instance &aInstance)
+        : mInstance(&aInstance)
+    {
+        FreeAll();
+    }
+
+    /**
+     * Destroys the allocated objects.
+     */
+    ~ObjectPool(void) { FreeAll(); }
+
+    /**
+     * Allocates an object from the pool, constructing it from given arguments.
+     *
+     * @tparam Args  The constructor argument types.
+     *
+     * @param[in] aArgs  The arguments to pass to the `Type` constructor.
+     *
+     * @returns A pointer to the new object, or `nullptr` if the pool is full.
+     */
+    template <typename... Args> Type *Allocate(Args &&...aArgs)
+    {
+        Type    *object = nullptr;
+        uint16_t index  = mFreeHead;
+
+        VerifyOrExit(index != kNoSlot);
+
+        mFreeHead = GetNextFree(index);
+        mAllocated.Set(index);
+        mNumAllocated++;
+
+        object = new (mSlots[index].mBytes) Type(Forward<Args>(aArgs)...);
+        InitObject(*object, TypeTraits::IsBaseOf<InstanceLocatorInit, Type>());
+
+    exit:
+        return object;
+    }
+
+    /**
+     * Frees an object, destroying it and returning its slot to the pool.
+     *
+     * @param[in] aObject  A pointer to the object (MUST have been allocated from this pool), or `nullptr` (ignored).
+     */
+    void Free(Type *aObject)
+    {
+        uint16_t index;
+
+        VerifyOrExit(aObject != nullptr);
+
+        index = GetIndex(*aObject);
+        TY_ASSERT(mAllocated.IsSet(index));
+
+        aObject->~Type();
+        mAllocated.Clear(index);
+        mNumAllocated--;
+        SetNextFree(index, mFreeHead);
+        mFreeHead = index;
+
+    exit:
+        return;
+    }
+
+    /**
+     * Frees all the allocated objects (destroying them).
+     */
+    void FreeAll(void)
+    {
+        for (uint16_t index : mAllocated)
+        {
+            GetObject(index)->~Type();
+        }
+
+        mAllocated.ClearAll();
+        mNumAllocated = 0;
+
+        for (uint16_t index = 0; index < kSize; index++)
+        {
+            SetNextFree(index, (index + 1 < kSize) ? static_cast<uint16_t>(index + 1) : kNoSlot);
+        }
+
+        mFreeHead = 0;
+    }
+
+    /**
+     * Indicates whether or not a given object is allocated from the pool.
+     *
+     * @param[in] aObject  The object.
+     *
+     * @retval TRUE   @p aObject is an allocated object of the pool.
+     * @retval FALSE  @p aObject is not an allocated object of the pool.
+     */
+    bool Contains(const Type &aObject) const
+    {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&aObject);
+        const uint8_t *start = mSlots[0].mBytes;
+        bool           contains;
+
+        contains = (bytes >= start) && (bytes < start + sizeof(mSlots)) &&
+                   ((static_cast<size_t>(bytes - start) % sizeof(Slot)) == 0) && mAllocated.IsSet(GetIndex(aObject));
+
+        return contains;
+    }
+
+    /**
+     * Returns the index of the slot of an allocated object (between zero and `kSize - 1`).
+     *
+     * @param[in] aObject  The object (MUST be allocated from this pool).
+     *
+     * @returns The index of the slot of @p aObject.
+     */
+    uint16_t GetIndex(const Type &aObject) const
+    {
+        return static_cast<uint16_t>(reinterpret_cast<const Slot *>(&aObject) - mSlots);
+    }
+
+    /**
+     * Returns the number of allocated objects.
+     *
+     * @returns The number of allocated objects.
+     */
+    uint16_t GetAllocatedCount(void) const { return mNumAllocated; }
+
+    /**
+     * Returns the number of free objects.
+     *
+     * @returns The number of free objects.
+     */
+    uint16_t GetFreeCount(void) const { return static_cast<uint16_t>(kSize - mNumAllocated); }
+
+    /**
+     * Returns the number of objects in the pool (allocated or free).
+     *
+     * @returns The number of objects in the pool.
+     */
+    uint16_t GetSize(void) const { return kSize; }
+
+    /**
+     * Indicates whether or not no object is allocated.
+     *
+     * @retval TRUE   No object is allocated.
+     * @retval FALSE  At least one object is allocated.
+     */
+    bool IsEmpty(void) const { return (mNumAllocated == 0); }
+
+    /**
+     * Indicates whether or not all the objects are allocated.
+     *
+     * @retval TRUE   All the objects are allocated.
+     * @retval FALSE  At least one object is free.
+     */
+    bool IsFull(void) const { return (mNumAllocated == kSize); }
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the allocated objects and should not be used
+    // directly.
+
+    Iterator      begin(void) { return Iterator(*this, mAllocated.begin()); }
+    Iterator      end(void) { return Iterator(*this, mAllocated.end()); }
+    ConstIterator begin(void) const { return ConstIterator(*this, mAllocated.begin()); }
+    ConstIterator end(void) const { return ConstIterator(*this, mAllocated.end()); }
+
+private:
+    static constexpr uint16_t kNoSlot = 0xffff;
+
+    // A free slot holds the index of the next free slot in its first
+    // bytes (copied with `memcpy()` since the slot has no object).
+    struct Slot
+    {
+        alignas(Type) uint8_t mBytes[(sizeof(Type) < sizeof(uint16_t)) ? sizeof(uint16_t) : sizeof(Type)];
+    };
+
+    Type       *GetObject(uint16_t aIndex) { return reinterpret_cast<Type *>(mSlots[aIndex].mBytes); }
+    const Type *GetObject(uint16_t aIndex) const { return reinterpret_cast<const Type *>(mSlots[aIndex].mBytes); }
+
+    uint16_t GetNextFree(uint16_t aIndex) const
+    {
+        uint16_t next;
+
+        memcpy(&next, mSlots[aIndex].mBytes, sizeof(next));
+        return next;
+    }
+
+    void SetNextFree(uint16_t aIndex, uint16_t aNext) { memcpy(mSlots[aIndex].mBytes, &aNext, sizeof(aNext)); }
+
+    // Templates, so that `Init()` is only required when it is used.
+    template <typename ObjectType> void InitObject(ObjectType &aObject, TypeTraits::TrueValue)
+    {
+        TY_ASSERT(mInstance != nullptr);
+        aObject.Init(*mInstance);
+    }
+
+    template <typename ObjectType> void InitObject(ObjectType &, TypeTraits::FalseValue) {}
+
+    Slot          mSlots[kSize];
+    Bitset<kSize> mAllocated;
+    Instance     *mInstance;
+    uint16_t      mFreeHead;
+    uint16_t      mNumAllocated;
+};
+
+} // namespace ty
+
+#endif // TY_OBJECT_POOL_HPP_
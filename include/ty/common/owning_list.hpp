@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for an intrusive linked list which owns its entries.
+ */
+
+#ifndef OWNING_LIST_HPP_
+#define OWNING_LIST_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include "ty/common/linked_list.hpp"
+#include "ty/common/non_copyable.hpp"
+
+namespace ty {
+
+/**
+ * Represents an intrusive linked list which owns its entries.
+ *
+ * Behaves as the underlying list (`LinkedList` or `DoublyLinkedList`), except that the entries in the list are freed
+ * when they are cleared or when the list is destroyed. An entry is freed by calling its `Free()` method, which MUST be
+ * provided by `Type` (e.g., to return the entry to the `ObjectPool` it was allocated from):
+ *
+ *     void Type::Free(void)
+ *
+ * An entry removed from the list with a method of the underlying list (e.g., `Pop()` or `RemoveMatching()`) is no
+ * longer owned by the list, and the caller becomes responsible for freeing it.
+ *
+ * @tparam Type      The entry type.
+ * @tparam ListType  The underlying list template (`LinkedList` or `DoublyLinkedList`).
+ */
+template <typename Type, template <typename> class ListType = LinkedList>
+class OwningList : public ListType<Type>, private NonCopyable
+{
+public:
+    /**
+     * Initializes the list as empty.
+     */
+    OwningList(void) = default;
+
+    /**
+     * Frees all the entries in the list.
+     */
+    ~OwningList(void) { Free(); }
+
+    /**
+     * Clears the list, freeing all its entries.
+     */
+    void Clear(void) { Free(); }
+
+    /**
+     * Removes all the entries from the list and frees them.
+     */
+    void Free(void)
+    {
+        Type *entry;
+
+        while ((entry = ListType<Type>::Pop()) != nullptr)
+        {
+            entry->Free();
+        }
+    }
+
+    /**
+     * Removes the first entry matching a given indicator and frees it.
+     *
+     * The `Matches()` method is invoked on each entry, and MUST be provided by `Type` accordingly:
+     *
+     *     bool Type::Matches(const Indicator &aIndicator) const
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     *
+     * @retval TRUE   A matching entry was removed and freed.
+     * @retval FALSE  There is no matching entry.
+     */
+    template <typename Indicator> bool RemoveAndFreeMatching(const Indicator &aIndicator)
+    {
+        Type *entry = ListType<Type>::RemoveMatching(aIndicator);
+
+        if (entry != nullptr)
+        {
+            entry->Free();
+        }
+
+        return (entry != nullptr);
+    }
+
+    /**
+     * Removes all the entries matching a given indicator and frees them.
+     *
+     * @param[in] aIndicator  An indicator to match with the entries.
+     */
+    template <typename Indicator> void RemoveAndFreeAllMatching(const Indicator &aIndicator)
+    {
+        OwningList removedList;
+
+        ListType<Type>::RemoveAllMatching(aIndicator, removedList);
+    }
+};
+
+} // namespace ty
+
+#endif // OWNING_LIST_HPP_
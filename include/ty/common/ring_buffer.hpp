@@ -0,0 +1,480 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for lock-free ring buffers (queues) between threads.
+ */
+
+#ifndef RING_BUFFER_HPP_
+#define RING_BUFFER_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "ty/common/atomic.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/non_copyable.hpp"
+#include "ty/common/num_utils.hpp"
+#include "ty/common/type_traits.hpp"
+#include "ty/platform/thread.h"
+
+namespace ty {
+
+/**
+ * Represents a lock-free single-producer single-consumer (SPSC) ring buffer.
+ *
+ * One thread (the producer) pushes entries and one other thread (the consumer) pops them, without any lock. The
+ * producer and consumer indices are in separate cache lines (see `TY_CONFIG_CACHE_LINE_SIZE`), and each side keeps a
+ * cached copy of the other side's index so it only reads the shared index (and so moves its cache line) when the
+ * ring appears full or empty.
+ *
+ * The `kCapacity` entries are constructed along with the ring. Entries are copied or moved (using `=` operator) in and
+ * out of the ring.
+ *
+ * @tparam Type       The entry type.
+ * @tparam kCapacity  The maximum number of entries in the ring (MUST be a power of two), e.g.,
+ *                    `CONFIG_TYPLATFORM_MAX_BACKLOG`.
+ */
+template <typename Type, uint16_t kCapacity> class SpscRing : private NonCopyable
+{
+    static_assert((kCapacity != 0) && ((kCapacity & (kCapacity - 1)) == 0), "SpscRing `kCapacity` MUST be a power of 2");
+
+public:
+    typedef Type EntryType; ///< The entry type.
+
+    /**
+     * Initializes the ring as empty.
+     */
+    SpscRing(void) = default;
+
+    /**
+     * Returns the capacity of the ring (maximum number of entries).
+     *
+     * @returns The capacity.
+     */
+    uint16_t GetCapacity(void) const { return kCapacity; }
+
+    /**
+     * Returns the number of entries in the ring.
+     *
+     * The result is exact only when called from the producer or the consumer thread while the other side is not
+     * active, otherwise it is a snapshot which may already be out of date.
+     *
+     * @returns The number of entries.
+     */
+    uint16_t GetLength(void) const
+    {
+        uint32_t head = mConsumer.mHead.Load(kMemoryOrderAcquire);
+
+        return static_cast<uint16_t>(mProducer.mTail.Load(kMemoryOrderAcquire) - head);
+    }
+
+    /**
+     * Indicates whether or not the ring is empty.
+     *
+     * @retval TRUE   The ring is empty.
+     * @retval FALSE  The ring is not empty.
+     */
+    bool IsEmpty(void) const { return GetLength() == 0; }
+
+    /**
+     * Pushes an entry to the ring. MUST only be called from the producer thread.
+     *
+     * @param[in] aEntry  The entry to push (copied into the ring).
+     *
+     * @retval kErrorNone    Successfully pushed @p aEntry.
+     * @retval kErrorNoBufs  The ring is full.
+     */
+    Error Push(const Type &aEntry) { return (PushEntries(&aEntry, 1) == 1) ? kErrorNone : kErrorNoBufs; }
+
+    /**
+     * Pushes an entry to the ring by moving it. MUST only be called from the producer thread.
+     *
+     * @param[in] aEntry  The entry to push (moved into the ring).
+     *
+     * @retval kErrorNone    Successfully pushed @p aEntry.
+     * @retval kErrorNoBufs  The ring is full.
+     */
+    Error Push(Type &&aEntry) { return (PushEntries(&aEntry, 1) == 1) ? kErrorNone : kErrorNoBufs; }
+
+    /**
+     * Pushes a batch of entries to the ring. MUST only be called from the producer thread.
+     *
+     * The entries are pushed in order and are made visible to the consumer all at once. If there is not enough room
+     * for all the entries, as many as fit are pushed.
+     *
+     * @param[in] aEntries  A pointer to the entries to push (copied into the ring).
+     * @param[in] aCount    The number of entries in @p aEntries.
+     *
+     * @returns The number of entries pushed.
+     */
+    uint16_t PushBatch(const Type *aEntries, uint16_t aCount) { return PushEntries(aEntries, aCount); }
+
+    /**
+     * Pops the oldest entry from the ring. MUST only be called from the consumer thread.
+     *
+     * @param[out] aEntry  A reference to output the popped entry (moved out of the ring).
+     *
+     * @retval kErrorNone      Successfully popped an entry.
+     * @retval kErrorNotFound  The ring is empty.
+     */
+    Error Pop(Type &aEntry) { return (PopBatch(&aEntry, 1) == 1) ? kErrorNone : kErrorNotFound; }
+
+    /**
+     * Pops a batch of the oldest entries from the ring. MUST only be called from the consumer thread.
+     *
+     * @param[out] aEntries    A pointer to an array to output the popped entries (moved out of the ring).
+     * @param[in]  aMaxCount   The maximum number of entries to pop (the size of @p aEntries).
+     *
+     * @returns The number of entries popped.
+     */
+    uint16_t PopBatch(Type *aEntries, uint16_t aMaxCount)
+    {
+        uint32_t head  = mConsumer.mHead.Load(kMemoryOrderRelaxed);
+        uint16_t count = static_cast<uint16_t>(mConsumer.mCachedTail - head);
+
+        if (count < aMaxCount)
+        {
+            mConsumer.mCachedTail = mProducer.mTail.Load(kMemoryOrderAcquire);
+            count                 = static_cast<uint16_t>(mConsumer.mCachedTail - head);
+        }
+
+        count = Min(count, aMaxCount);
+
+        for (uint16_t index = 0; index < count; index++)
+        {
+            aEntries[index] = Move(mEntries[(head + index) & kIndexMask]);
+        }
+
+        mConsumer.mHead.Store(head + count, kMemoryOrderRelease);
+
+        return count;
+    }
+
+private:
+    static constexpr uint32_t kIndexMask = kCapacity - 1;
+
+    // The indices are free-running (they wrap at 2^32, which is a
+    // multiple of `kCapacity`), so `tail - head` is the number of
+    // entries in the ring.
+
+    struct alignas(TY_CONFIG_CACHE_LINE_SIZE) ProducerState
+    {
+        Atomic<uint32_t> mTail;
+        uint32_t         mCachedHead = 0;
+    };
+
+    struct alignas(TY_CONFIG_CACHE_LINE_SIZE) ConsumerState
+    {
+        Atomic<uint32_t> mHead;
+        uint32_t         mCachedTail = 0;
+    };
+
+    template <typename EntryPointer> uint16_t PushEntries(EntryPointer aEntries, uint16_t aCount)
+    {
+        uint32_t tail  = mProducer.mTail.Load(kMemoryOrderRelaxed);
+        uint16_t count = static_cast<uint16_t>(kCapacity - (tail - mProducer.mCachedHead));
+
+        if (count < aCount)
+        {
+            mProducer.mCachedHead = mConsumer.mHead.Load(kMemoryOrderAcquire);
+            count                 = static_cast<uint16_t>(kCapacity - (tail - mProducer.mCachedHead));
+        }
+
+        count = Min(count, aCount);
+
+        for (uint16_t index = 0; index < count; index++)
+        {
+            mEntries[(tail + index) & kIndexMask] = Move(aEntries[index]);
+        }
+
+        mProducer.mTail.Store(tail + count, kMemoryOrderRelease);
+
+        return count;
+    }
+
+    ProducerState mProducer;
+    ConsumerState mConsumer;
+    Type          mEntries[kCapacity];
+};
+
+/**
+ * Represents a lock-free multi-producer single-consumer (MPSC) ring buffer.
+ *
+ * Any number of threads (the producers) push entries and one thread (the consumer) pops them, without any lock. A
+ * producer claims room in the ring by advancing the shared tail index (compare-and-exchange), then writes its entries
+ * and publishes each one through a per-entry sequence number. The consumer pops the entries in the order they were
+ * claimed, so an entry being written by a slow (e.g., preempted) producer holds back the entries claimed after it.
+ *
+ * The `kCapacity` entries are constructed along with the ring. Entries are copied or moved (using `=` operator) in and
+ * out of the ring.
+ *
+ * @tparam Type       The entry type.
+ * @tparam kCapacity  The maximum number of entries in the ring (MUST be a power of two).
+ */
+template <typename Type, uint16_t kCapacity> class MpscRing : private NonCopyable
+{
+    static_assert((kCapacity != 0) && ((kCapacity & (kCapacity - 1)) == 0), "MpscRing `kCapacity` MUST be a power of 2");
+
+public:
+    typedef Type EntryType; ///< The entry type.
+
+    /**
+     * Initializes the ring as empty.
+     */
+    MpscRing(void) = default;
+
+    /**
+     * Returns the capacity of the ring (maximum number of entries).
+     *
+     * @returns The capacity.
+     */
+    uint16_t GetCapacity(void) const { return kCapacity; }
+
+    /**
+     * Returns the number of entries in the ring (including the ones being pushed).
+     *
+     * The result is a snapshot which may already be out of date when other threads are active.
+     *
+     * @returns The number of entries.
+     */
+    uint16_t GetLength(void) const
+    {
+        uint32_t head = mHead.Load(kMemoryOrderAcquire);
+
+        return static_cast<uint16_t>(mTail.Load(kMemoryOrderAcquire) - head);
+    }
+
+    /**
+     * Indicates whether or not the ring is empty.
+     *
+     * @retval TRUE   The ring is empty.
+     * @retval FALSE  The ring is not empty.
+     */
+    bool IsEmpty(void) const { return GetLength() == 0; }
+
+    /**
+     * Pushes an entry to the ring. Can be called from any thread.
+     *
+     * @param[in] aEntry  The entry to push (copied into the ring).
+     *
+     * @retval kErrorNone    Successfully pushed @p aEntry.
+     * @retval kErrorNoBufs  The ring is full.
+     */
+    Error Push(const Type &aEntry) { return (PushEntries(&aEntry, 1) == 1) ? kErrorNone : kErrorNoBufs; }
+
+    /**
+     * Pushes an entry to the ring by moving it. Can be called from any thread.
+     *
+     * @param[in] aEntry  The entry to push (moved into the ring).
+     *
+     * @retval kErrorNone    Successfully pushed @p aEntry.
+     * @retval kErrorNoBufs  The ring is full.
+     */
+    Error Push(Type &&aEntry) { return (PushEntries(&aEntry, 1) == 1) ? kErrorNone : kErrorNoBufs; }
+
+    /**
+     * Pushes a batch of entries to the ring. Can be called from any thread.
+     *
+     * The room for the entries is claimed at once, so the entries are contiguous in the ring (not interleaved with
+     * entries from other producers). If there is not enough room for all the entries, as many as fit are pushed.
+     *
+     * @param[in] aEntries  A pointer to the entries to push (copied into the ring).
+     * @param[in] aCount    The number of entries in @p aEntries.
+     *
+     * @returns The number of entries pushed.
+     */
+    uint16_t PushBatch(const Type *aEntries, uint16_t aCount) { return PushEntries(aEntries, aCount); }
+
+    /**
+     * Pops the oldest entry from the ring. MUST only be called from the consumer thread.
+     *
+     * @param[out] aEntry  A reference to output the popped entry (moved out of the ring).
+     *
+     * @retval kErrorNone      Successfully popped an entry.
+     * @retval kErrorNotFound  The ring is empty (or the oldest entry is still being pushed).
+     */
+    Error Pop(Type &aEntry) { return (PopBatch(&aEntry, 1) == 1) ? kErrorNone : kErrorNotFound; }
+
+    /**
+     * Pops a batch of the oldest entries from the ring. MUST only be called from the consumer thread.
+     *
+     * Stops at the first entry which is still being pushed.
+     *
+     * @param[out] aEntries    A pointer to an array to output the popped entries (moved out of the ring).
+     * @param[in]  aMaxCount   The maximum number of entries to pop (the size of @p aEntries).
+     *
+     * @returns The number of entries popped.
+     */
+    uint16_t PopBatch(Type *aEntries, uint16_t aMaxCount)
+    {
+        uint32_t head  = mHead.Load(kMemoryOrderRelaxed);
+        uint16_t count = 0;
+
+        for (; count < aMaxCount; count++)
+        {
+            Slot &slot = mSlots[(head + count) & kIndexMask];
+
+            if (slot.mSequence.Load(kMemoryOrderAcquire) != head + count + 1)
+            {
+                break;
+            }
+
+            aEntries[count] = Move(slot.mEntry);
+        }
+
+        mHead.Store(head + count, kMemoryOrderRelease);
+
+        return count;
+    }
+
+private:
+    static constexpr uint32_t kIndexMask = kCapacity - 1;
+
+    // The indices are free-running (they wrap at 2^32, which is a
+    // multiple of `kCapacity`). The entry at index `i` is published
+    // by setting the sequence of its slot to `i + 1`. A sequence left
+    // from the previous use of the slot is `i + 1 - kCapacity`, so it
+    // is never mistaken for a published entry.
+
+    struct Slot
+    {
+        Atomic<uint32_t> mSequence;
+        Type             mEntry;
+    };
+
+    template <typename EntryPointer> uint16_t PushEntries(EntryPointer aEntries, uint16_t aCount)
+    {
+        uint32_t tail = mTail.Load(kMemoryOrderRelaxed);
+        uint16_t count;
+
+        // The head is loaded with acquire so that the consumer has
+        // finished moving the entries out of the slots being reused.
+        // If the claim succeeds, `tail` was current so the head
+        // (which never passes the tail) is not ahead of it.
+
+        do
+        {
+            uint32_t length = tail - mHead.Load(kMemoryOrderAcquire);
+
+            count = (length < kCapacity) ? static_cast<uint16_t>(Min<uint32_t>(kCapacity - length, aCount)) : 0;
+            VerifyOrExit(count > 0);
+
+        } while (!mTail.CompareExchangeWeak(tail, tail + count, kMemoryOrderRelaxed, kMemoryOrderRelaxed));
+
+        for (uint16_t index = 0; index < count; index++)
+        {
+            Slot &slot = mSlots[(tail + index) & kIndexMask];
+
+            slot.mEntry = Move(aEntries[index]);
+            slot.mSequence.Store(tail + index + 1, kMemoryOrderRelease);
+        }
+
+    exit:
+        return count;
+    }
+
+    alignas(TY_CONFIG_CACHE_LINE_SIZE) Atomic<uint32_t> mTail;
+    alignas(TY_CONFIG_CACHE_LINE_SIZE) Atomic<uint32_t> mHead;
+    alignas(TY_CONFIG_CACHE_LINE_SIZE) Slot mSlots[kCapacity];
+};
+
+/**
+ * Adds blocking (waiting) push and pop to a ring buffer (`SpscRing` or `MpscRing`).
+ *
+ * The platform layer does not provide a wait/notify primitive, so a waiting call first spins for a short while (to
+ * catch an entry or room that becomes available within microseconds without a context switch) and then polls, sleeping
+ * for one millisecond (`tyPlatDelay()`) between attempts. The push and pop themselves remain lock-free.
+ *
+ * @tparam Ring  The ring buffer type.
+ */
+template <typename Ring> class BlockingRing : public Ring
+{
+public:
+    typedef typename Ring::EntryType EntryType; ///< The entry type.
+
+    static constexpr uint32_t kWaitForever = 0xffffffff; ///< Timeout value to wait forever.
+
+    /**
+     * Pushes an entry to the ring, waiting for room if the ring is full.
+     *
+     * Follows the same thread restrictions as `Ring::Push()`.
+     *
+     * @param[in] aEntry      The entry to push (copied into the ring).
+     * @param[in] aTimeoutMs  The maximum time to wait in milliseconds, or `kWaitForever`.
+     *
+     * @retval kErrorNone    Successfully pushed @p aEntry.
+     * @retval kErrorNoBufs  The ring remained full until the timeout.
+     */
+    Error PushWait(const EntryType &aEntry, uint32_t aTimeoutMs)
+    {
+        return Wait([this, &aEntry]() { return Ring::Push(aEntry); }, kErrorNoBufs, aTimeoutMs);
+    }
+
+    /**
+     * Pushes an entry to the ring by moving it, waiting for room if the ring is full.
+     *
+     * Follows the same thread restrictions as `Ring::Push()`.
+     *
+     * @param[in] aEntry      The entry to push (moved into the ring).
+     * @param[in] aTimeoutMs  The maximum time to wait in milliseconds, or `kWaitForever`.
+     *
+     * @retval kErrorNone    Successfully pushed @p aEntry.
+     * @retval kErrorNoBufs  The ring remained full until the timeout.
+     */
+    Error PushWait(EntryType &&aEntry, uint32_t aTimeoutMs)
+    {
+        return Wait([this, &aEntry]() { return Ring::Push(Move(aEntry)); }, kErrorNoBufs, aTimeoutMs);
+    }
+
+    /**
+     * Pops the oldest entry from the ring, waiting for an entry if the ring is empty.
+     *
+     * MUST only be called from the consumer thread.
+     *
+     * @param[out] aEntry      A reference to output the popped entry.
+     * @param[in]  aTimeoutMs  The maximum time to wait in milliseconds, or `kWaitForever`.
+     *
+     * @retval kErrorNone      Successfully popped an entry.
+     * @retval kErrorNotFound  The ring remained empty until the timeout.
+     */
+    Error PopWait(EntryType &aEntry, uint32_t aTimeoutMs)
+    {
+        return Wait([this, &aEntry]() { return Ring::Pop(aEntry); }, kErrorNotFound, aTimeoutMs);
+    }
+
+private:
+    static constexpr uint16_t kNumSpins   = 1000;
+    static constexpr uint32_t kPollPeriod = 1; // in msec
+
+    template <typename Operation> static Error Wait(const Operation &aOperation, Error aRetryError, uint32_t aTimeoutMs)
+    {
+        Error    error;
+        uint16_t numSpins = 0;
+        uint32_t waitedMs = 0;
+
+        while ((error = aOperation()) == aRetryError)
+        {
+            if (numSpins < kNumSpins)
+            {
+                numSpins++;
+                CpuRelax();
+                continue;
+            }
+
+            VerifyOrExit((aTimeoutMs == kWaitForever) || (waitedMs < aTimeoutMs));
+            tyPlatDelay(kPollPeriod);
+            waitedMs += kPollPeriod;
+        }
+
+    exit:
+        return error;
+    }
+};
+
+} // namespace ty
+
+#endif // RING_BUFFER_HPP_
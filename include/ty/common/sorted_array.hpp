@@ -0,0 +1,302 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for a sorted array.
+ */
+
+#ifndef SORTED_ARRAY_HPP_
+#define SORTED_ARRAY_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include "ty/common/array.hpp"
+#include "ty/common/binary_search.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/const_cast.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/numeric_limits.hpp"
+#include "ty/common/type_traits.hpp"
+
+namespace ty {
+
+/**
+ * Represents an array of elements with a fixed max size, kept sorted.
+ *
+ * The elements are stored in an `Array` and kept in order as they are inserted, so lookups use binary search
+ * (logarithmic time) instead of a linear scan. Insertion and removal preserve the order by moving the elements after
+ * the insertion or removal point (using `memmove()` if `Type` is trivially copyable).
+ *
+ * `Type` MUST follow the same conventions as the entries used with `BinarySearch`, i.e., provide the following methods
+ * to order the entries and to compare an entry against a key:
+ *
+ *    static bool Type::AreInOrder(const Type &aFirst, const Type &aSecond);
+ *    int Type::Compare(const Key &aKey) const;
+ *
+ * `AreInOrder()` MUST return TRUE if `aFirst < aSecond`. `Compare()` returns the comparison result between @p aKey and
+ * the entry (similar to `strcmp()`), i.e., zero means match, positive (> 0) indicates @p aKey is larger than entry, and
+ * negative indicates @p aKey is smaller than entry. `Compare()` MUST be consistent with the order from `AreInOrder()`.
+ * It can be provided for multiple `Key` types, e.g., for a key type and for `Type` itself.
+ *
+ * @tparam Type        The array element type.
+ * @tparam kMaxSize    Specifies the max array size (maximum number of elements in the array).
+ * @tparam SizeType    The type to be used for array size, length, and index. If not specified, a default `uint` type
+ *                     is determined based on `kMaxSize`, i.e., if `kMaxSize <= 255` then `uint8_t` will be used,
+ *                     otherwise `uint16_t` will be used.
+ */
+template <typename Type,
+          uint16_t kMaxSize,
+          typename SizeType =
+              typename TypeTraits::Conditional<kMaxSize <= NumericLimits<uint8_t>::kMax, uint8_t, uint16_t>::Type>
+class SortedArray
+{
+public:
+    /**
+     * Represents the length or index in array.
+     */
+    typedef SizeType IndexType;
+
+    /**
+     * Clears the array.
+     */
+    void Clear(void) { mArray.Clear(); }
+
+    /**
+     * Indicates whether or not the array is empty.
+     *
+     * @retval TRUE when array is empty.
+     * @retval FALSE when array is not empty.
+     */
+    bool IsEmpty(void) const { return mArray.IsEmpty(); }
+
+    /**
+     * Indicates whether or not the array is full.
+     *
+     * @retval TRUE when array is full.
+     * @retval FALSE when array is not full.
+     */
+    bool IsFull(void) const { return mArray.IsFull(); }
+
+    /**
+     * Returns the maximum array size (max number of elements).
+     *
+     * @returns The maximum array size (max number of elements that can be added to the array).
+     */
+    IndexType GetMaxSize(void) const { return mArray.GetMaxSize(); }
+
+    /**
+     * Returns the current length of array (number of elements).
+     *
+     * @returns The current array length.
+     */
+    IndexType GetLength(void) const { return mArray.GetLength(); }
+
+    /**
+     * Overloads the `[]` operator to get the element at a given index.
+     *
+     * Does not perform index bounds checking. Behavior is undefined if @p aIndex is not valid.
+     *
+     * The caller MUST NOT change the element in a way that changes its order in the array.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A reference to the element in array at @p aIndex.
+     */
+    Type &operator[](IndexType aIndex) { return mArray[aIndex]; }
+
+    /**
+     * Overloads the `[]` operator to get the element at a given index.
+     *
+     * Does not perform index bounds checking. Behavior is undefined if @p aIndex is not valid.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A reference to the element in array at @p aIndex.
+     */
+    const Type &operator[](IndexType aIndex) const { return mArray[aIndex]; }
+
+    /**
+     * Gets a pointer to the element at a given index.
+     *
+     * The caller MUST NOT change the element in a way that changes its order in the array.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A pointer to element in array at @p aIndex or `nullptr` if @p aIndex is not valid.
+     */
+    Type *At(IndexType aIndex) { return mArray.At(aIndex); }
+
+    /**
+     * Gets a pointer to the element at a given index.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns A pointer to element in array at @p aIndex or `nullptr` if @p aIndex is not valid.
+     */
+    const Type *At(IndexType aIndex) const { return mArray.At(aIndex); }
+
+    /**
+     * Gets a pointer to the smallest element in the array (first element).
+     *
+     * @returns A pointer to the front element or `nullptr` if array is empty.
+     */
+    const Type *Front(void) const { return mArray.Front(); }
+
+    /**
+     * Gets a pointer to the largest element in the array (last element).
+     *
+     * @returns A pointer to the back element or `nullptr` if array is empty.
+     */
+    const Type *Back(void) const { return mArray.Back(); }
+
+    /**
+     * Returns the index of an element in the array.
+     *
+     * The @p aElement MUST be from the array, otherwise the behavior of this method is undefined.
+     *
+     * @param[in] aElement  A reference to an element in the array.
+     *
+     * @returns The index of @p aElement in the array.
+     */
+    IndexType IndexOf(const Type &aElement) const { return mArray.IndexOf(aElement); }
+
+    /**
+     * Returns the index of the first element in the array which is not smaller than a given key.
+     *
+     * @tparam Key   The key type.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @returns The index of the first element not smaller than @p aKey, or the current length if there is none.
+     */
+    template <typename Key> IndexType LowerBound(const Key &aKey) const
+    {
+        return static_cast<IndexType>(BinarySearch::LowerBound(aKey, mArray.begin(), mArray.GetLength()));
+    }
+
+    /**
+     * Returns the index of the first element in the array which is larger than a given key.
+     *
+     * @tparam Key   The key type.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @returns The index of the first element larger than @p aKey, or the current length if there is none.
+     */
+    template <typename Key> IndexType UpperBound(const Key &aKey) const
+    {
+        return static_cast<IndexType>(BinarySearch::UpperBound(aKey, mArray.begin(), mArray.GetLength()));
+    }
+
+    /**
+     * Finds an element matching a given key in the array using binary search.
+     *
+     * If there are multiple matching elements, the first one is returned.
+     *
+     * The caller MUST NOT change the element in a way that changes its order in the array.
+     *
+     * @tparam Key   The key type.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @returns A pointer to the matching element, or `nullptr` if there is no match.
+     */
+    template <typename Key> Type *Find(const Key &aKey) { return AsNonConst(AsConst(this)->Find(aKey)); }
+
+    /**
+     * Finds an element matching a given key in the array using binary search.
+     *
+     * If there are multiple matching elements, the first one is returned.
+     *
+     * @tparam Key   The key type.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @returns A pointer to the matching element, or `nullptr` if there is no match.
+     */
+    template <typename Key> const Type *Find(const Key &aKey) const
+    {
+        return BinarySearch::Find(aKey, mArray.begin(), mArray.GetLength());
+    }
+
+    /**
+     * Indicates whether or not the array contains an element matching a given key.
+     *
+     * @tparam Key   The key type.
+     *
+     * @param[in] aKey   The key to search for.
+     *
+     * @retval TRUE   The array contains an element matching @p aKey.
+     * @retval FALSE  The array does not contain an element matching @p aKey.
+     */
+    template <typename Key> bool Contains(const Key &aKey) const { return Find(aKey) != nullptr; }
+
+    /**
+     * Inserts a new entry in the array at its sorted position.
+     *
+     * If there are elements equal to @p aEntry, the new entry is inserted after them. The method uses assignment `=`
+     * operator on `Type` to copy @p aEntry into the array.
+     *
+     * @param[in] aEntry     The new entry to insert.
+     *
+     * @retval kErrorNone    Successfully inserted @p aEntry.
+     * @retval kErrorNoBufs  Could not insert the new element since array is full.
+     */
+    Error Insert(const Type &aEntry) { return mArray.Insert(FindInsertIndex(aEntry), aEntry); }
+
+    /**
+     * Inserts a new entry in the array at its sorted position by moving it.
+     *
+     * If there are elements equal to @p aEntry, the new entry is inserted after them. The method uses move assignment
+     * `=` operator on `Type` to move @p aEntry into the array.
+     *
+     * @param[in] aEntry     The new entry to insert.
+     *
+     * @retval kErrorNone    Successfully inserted @p aEntry.
+     * @retval kErrorNoBufs  Could not insert the new element since array is full.
+     */
+    Error Insert(Type &&aEntry) { return mArray.Insert(FindInsertIndex(aEntry), Move(aEntry)); }
+
+    /**
+     * Removes an element from the array, preserving the order of the remaining elements.
+     *
+     * The @p aElement MUST be from the array, otherwise the behavior of this method is undefined.
+     *
+     * @param[in] aElement   A reference to the element to remove.
+     */
+    void Remove(Type &aElement) { IgnoreError(mArray.RemoveAt(mArray.IndexOf(aElement))); }
+
+    /**
+     * Removes the element at a given index from the array, preserving the order of the remaining elements.
+     *
+     * @param[in] aIndex   The index of the element to remove.
+     *
+     * @retval kErrorNone         Successfully removed the element at @p aIndex.
+     * @retval kErrorInvalidArgs  The @p aIndex is not less than the current length.
+     */
+    Error RemoveAt(IndexType aIndex) { return mArray.RemoveAt(aIndex); }
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the array elements (in sorted order) and
+    // should not be used directly.
+
+    Type       *begin(void) { return mArray.begin(); }
+    Type       *end(void) { return mArray.end(); }
+    const Type *begin(void) const { return mArray.begin(); }
+    const Type *end(void) const { return mArray.end(); }
+
+private:
+    IndexType FindInsertIndex(const Type &aEntry) const
+    {
+        auto isAfter = [&aEntry](const Type &aElement) { return Type::AreInOrder(aEntry, aElement); };
+
+        return static_cast<IndexType>(BinarySearch::PartitionPoint(mArray.begin(), mArray.GetLength(), isAfter));
+    }
+
+    Array<Type, kMaxSize, SizeType> mArray;
+};
+
+} // namespace ty
+
+#endif // SORTED_ARRAY_HPP_
@@ -123,7 +123,95 @@ struct FirstArgTypeOf<RetType (*)(FirstArgType, Args...)>
     typedef FirstArgType Type; ///< The first argument type.
 };
 
+/**
+ * Removes the reference (if any) from a given type.
+ *
+ * It provides member type named `Type` which gives the referred type, e.g., `RemoveReference<int &>::Type` and
+ * `RemoveReference<int &&>::Type` would both be `int`.
+ *
+ * @tparam InputType   The type to remove reference from.
+ */
+template <typename InputType> struct RemoveReference
+{
+    typedef InputType Type; ///< The type without reference.
+};
+
+template <typename InputType> struct RemoveReference<InputType &>
+{
+    typedef InputType Type;
+};
+
+template <typename InputType> struct RemoveReference<InputType &&>
+{
+    typedef InputType Type;
+};
+
+/**
+ * Indicates whether or not a given template `Type` is trivially copyable.
+ *
+ * The `constexpr` expression `IsTriviallyCopyable<Type>::kValue` would be `true` when objects of `Type` can be copied
+ * by copying their underlying bytes (e.g., using `memcpy()`), otherwise it would be `false`.
+ *
+ * @tparam Type    A type to check if is trivially copyable.
+ */
+template <typename Type>
+struct IsTriviallyCopyable : public Conditional<__is_trivially_copyable(Type), TrueValue, FalseValue>::Type
+{
+};
+
+/**
+ * Indicates whether or not a given template `BaseType` is a base class of `DerivedType` (or the same class).
+ *
+ * The `constexpr` expression `IsBaseOf<BaseType, DerivedType>::kValue` would be `true` when `DerivedType` derives
+ * from `BaseType`, otherwise it would be `false`.
+ *
+ * @tparam BaseType     The base class type.
+ * @tparam DerivedType  A type to check if it derives from `BaseType`.
+ */
+template <typename BaseType, typename DerivedType>
+struct IsBaseOf : public Conditional<__is_base_of(BaseType, DerivedType), TrueValue, FalseValue>::Type
+{
+};
+
 } // namespace TypeTraits
+
+/**
+ * Casts a given object to an rvalue reference, indicating that it may be moved from.
+ *
+ * This is equivalent to `std::move()`.
+ *
+ * @tparam Type   The object type.
+ *
+ * @param[in] aObject   The object to move.
+ *
+ * @returns An rvalue reference to @p aObject.
+ */
+template <typename Type> constexpr typename TypeTraits::RemoveReference<Type>::Type &&Move(Type &&aObject)
+{
+    return static_cast<typename TypeTraits::RemoveReference<Type>::Type &&>(aObject);
+}
+
+/**
+ * Forwards a given argument preserving its value category (lvalue or rvalue).
+ *
+ * This is equivalent to `std::forward()` and is intended to be used with forwarding references in templates.
+ *
+ * @tparam Type   The argument type (MUST be explicitly specified).
+ *
+ * @param[in] aArg   The argument to forward.
+ *
+ * @returns @p aArg as an lvalue reference if `Type` is an lvalue reference type, otherwise as an rvalue reference.
+ */
+template <typename Type> constexpr Type &&Forward(typename TypeTraits::RemoveReference<Type>::Type &aArg)
+{
+    return static_cast<Type &&>(aArg);
+}
+
+template <typename Type> constexpr Type &&Forward(typename TypeTraits::RemoveReference<Type>::Type &&aArg)
+{
+    return static_cast<Type &&>(aArg);
+}
+
 } // namespace ty
 
 #endif // TY_TYPE_TRAITS_HPP_
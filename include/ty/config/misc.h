@@ -157,7 +157,10 @@
  *
  * Whether use heap allocator for message buffers.
  *
- * @note If this is set, TY_CONFIG_NUM_MESSAGE_BUFFERS is ignored.
+ * @note If this is set, the message buffers are allocated from the heap on demand (instead of from a static pool), and
+ * TY_CONFIG_NUM_MESSAGE_BUFFERS only limits the number of buffers in use at the same time. The internal heap (when
+ * TY_CONFIG_HEAP_EXTERNAL_ENABLE is not set) is then enlarged to hold all the buffers in addition to its configured
+ * size.
  */
 #ifndef TY_CONFIG_MESSAGE_USE_HEAP_ENABLE
 #define TY_CONFIG_MESSAGE_USE_HEAP_ENABLE 0
@@ -190,6 +193,40 @@
 #define TY_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE
+ *
+ * The maximum number of free message buffers in each per-thread cache of the pool (zero to disable the caches).
+ *
+ * The caches let threads allocate and free message buffers mostly without accessing the shared pool, which reduces
+ * contention between threads on multi-core systems. Requires `thread_local` support. Ignored if
+ * TY_CONFIG_MESSAGE_USE_HEAP_ENABLE is set.
+ */
+#ifndef TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE
+#define TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE 0
+#endif
+
+/**
+ * @def TY_CONFIG_MESSAGE_POOL_NUM_THREAD_CACHES
+ *
+ * The number of per-thread caches in the message pool (see TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE).
+ *
+ * Threads are assigned the caches round-robin, so more threads than caches share them.
+ */
+#ifndef TY_CONFIG_MESSAGE_POOL_NUM_THREAD_CACHES
+#define TY_CONFIG_MESSAGE_POOL_NUM_THREAD_CACHES 4
+#endif
+
+/**
+ * @def TY_CONFIG_MESSAGE_IOVEC_ENABLE
+ *
+ * Define to 1 to enable exporting the content of a message as an array of `struct iovec` (from `<sys/uio.h>`), for
+ * scatter/gather I/O functions such as `writev()` and `sendmsg()`.
+ */
+#ifndef TY_CONFIG_MESSAGE_IOVEC_ENABLE
+#define TY_CONFIG_MESSAGE_IOVEC_ENABLE 0
+#endif
+
 /**
  * @def TY_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -254,7 +291,8 @@
 /**
  * @def TY_CONFIG_HEAP_INTERNAL_SIZE
  *
- * The size of heap buffer when DTLS is enabled.
+ * The size of heap buffer when DTLS is enabled, i.e., when mbedTLS allocates from the heap (refer to
+ * TY_CONFIG_MBEDTLS_HEAP_ENABLE).
  */
 #ifndef TY_CONFIG_HEAP_INTERNAL_SIZE
 #if TY_CONFIG_SRP_SERVER_ENABLE
@@ -283,15 +321,93 @@
 #endif
 #endif
 
+/**
+ * @def TY_CONFIG_ARENA_OVERFLOW_HEAP_SIZE
+ *
+ * The size (in bytes) added to the internal heap for the overflow blocks of the arenas (see `Arena`), or zero if the
+ * arenas never overflow to the heap.
+ *
+ * The overflow blocks in use at the same time MUST fit in this size, along with the overhead of each heap block (refer
+ * to `Tlsf::GetRegionSizeFor()`). The default holds a single block of up to about 1000 bytes.
+ *
+ * @note This has no effect if TY_CONFIG_HEAP_EXTERNAL_ENABLE is set.
+ */
+#ifndef TY_CONFIG_ARENA_OVERFLOW_HEAP_SIZE
+#define TY_CONFIG_ARENA_OVERFLOW_HEAP_SIZE 1024
+#endif
+
 /**
  * @def TY_CONFIG_HEAP_EXTERNAL_ENABLE
  *
  * Enable the external heap.
+ *
+ * @note If this is set, the heap allocations are routed to the platform allocator (`tyPlatCAlloc()`,
+ * `tyPlatRealloc()` and `tyPlatFree()`), otherwise they use the internal TLSF heap of TY_CONFIG_HEAP_INTERNAL_SIZE
+ * (or TY_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS) bytes.
  */
 #ifndef TY_CONFIG_HEAP_EXTERNAL_ENABLE
 #define TY_CONFIG_HEAP_EXTERNAL_ENABLE 0
 #endif
 
+/**
+ * @def TY_CONFIG_HEAP_THREAD_SAFE_ENABLE
+ *
+ * Define as 1 to protect the internal heap with the platform heap lock (`tyPlatHeapLock()`), so that it can be used
+ * from multiple threads.
+ *
+ * @note This has no effect if TY_CONFIG_HEAP_EXTERNAL_ENABLE is set (the platform allocator is expected to be
+ * thread-safe).
+ */
+#ifndef TY_CONFIG_HEAP_THREAD_SAFE_ENABLE
+#define TY_CONFIG_HEAP_THREAD_SAFE_ENABLE 0
+#endif
+
+/**
+ * @def TY_CONFIG_MBEDTLS_HEAP_ENABLE
+ *
+ * Define as 1 for mbedTLS to allocate from a dedicated internal heap region of TY_CONFIG_MBEDTLS_HEAP_SIZE bytes,
+ * instead of from the heap.
+ *
+ * @note This has no effect if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT is not set.
+ */
+#ifndef TY_CONFIG_MBEDTLS_HEAP_ENABLE
+#define TY_CONFIG_MBEDTLS_HEAP_ENABLE 1
+#endif
+
+/**
+ * @def TY_CONFIG_MBEDTLS_HEAP_SIZE
+ *
+ * The size of the dedicated mbedTLS heap region (including the small blocks).
+ */
+#ifndef TY_CONFIG_MBEDTLS_HEAP_SIZE
+#if TY_CONFIG_COAP_SECURE_API_ENABLE
+#define TY_CONFIG_MBEDTLS_HEAP_SIZE (3136 * sizeof(void *))
+#else
+#define TY_CONFIG_MBEDTLS_HEAP_SIZE (1616 * sizeof(void *))
+#endif
+#endif
+
+/**
+ * @def TY_CONFIG_MBEDTLS_HEAP_SMALL_BLOCK_SIZE
+ *
+ * The size of the small blocks of the dedicated mbedTLS heap region (MUST be a multiple of 8).
+ *
+ * The allocations of up to this size are served from a pool of fixed-size blocks, and only fall back to the TLSF
+ * allocator when the pool is exhausted.
+ */
+#ifndef TY_CONFIG_MBEDTLS_HEAP_SMALL_BLOCK_SIZE
+#define TY_CONFIG_MBEDTLS_HEAP_SMALL_BLOCK_SIZE 64
+#endif
+
+/**
+ * @def TY_CONFIG_MBEDTLS_HEAP_NUM_SMALL_BLOCKS
+ *
+ * The number of small blocks of the dedicated mbedTLS heap region (zero to disable them).
+ */
+#ifndef TY_CONFIG_MBEDTLS_HEAP_NUM_SMALL_BLOCKS
+#define TY_CONFIG_MBEDTLS_HEAP_NUM_SMALL_BLOCKS 16
+#endif
+
 /**
  * @def TY_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH
  *
@@ -562,6 +678,18 @@
 #define TY_CONFIG_PLATFORM_LOG_CRASH_DUMP_ENABLE 0
 #endif
 
+/**
+ * @def TY_CONFIG_CACHE_LINE_SIZE
+ *
+ * The size (in bytes) of a CPU cache line.
+ *
+ * Used to place data written by different threads (e.g., the indices of a ring buffer) in separate cache lines to
+ * avoid false sharing. Can be reduced (e.g., to 4) on targets without a data cache to save RAM.
+ */
+#ifndef TY_CONFIG_CACHE_LINE_SIZE
+#define TY_CONFIG_CACHE_LINE_SIZE 64
+#endif
+
 /**
  * @}
  */
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief
+ *  This file defines the memory usage statistics API.
+ */
+
+#ifndef TY_MEMORY_H_
+#define TY_MEMORY_H_
+
+#include <stdint.h>
+
+#include <ty/error.h>
+#include <ty/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-memory
+ *
+ * @brief
+ *   This module includes functions to get the memory usage statistics of the allocators (e.g., to size
+ *   `TY_CONFIG_NUM_MESSAGE_BUFFERS` and `TY_CONFIG_HEAP_INTERNAL_SIZE` from the high-water marks).
+ *
+ * @{
+ */
+
+#define TY_MEMORY_HISTOGRAM_SIZE 8 ///< Number of buckets in the allocation size histogram.
+
+/**
+ * Represents an allocator.
+ */
+typedef enum tinyMemoryAllocator
+{
+    TY_MEMORY_ALLOCATOR_HEAP         = 0, ///< The heap (internal or external).
+    TY_MEMORY_ALLOCATOR_MESSAGE_POOL = 1, ///< The message buffer pool.
+    TY_MEMORY_ALLOCATOR_MBEDTLS      = 2, ///< The mbedTLS heap (the heap if it has no dedicated region).
+    TY_NUM_MEMORY_ALLOCATORS,             ///< The number of allocators.
+} tinyMemoryAllocator;
+
+/**
+ * Represents the module which allocates memory from the heap (to account the heap usage per module).
+ */
+typedef enum tinyMemoryTag
+{
+    TY_MEMORY_TAG_OTHER   = 0, ///< Allocations by other modules.
+    TY_MEMORY_TAG_MESSAGE = 1, ///< Message buffers (when allocated from the heap).
+    TY_MEMORY_TAG_ARENA   = 2, ///< Arena overflow blocks.
+    TY_MEMORY_TAG_MBEDTLS = 3, ///< mbedTLS (when it has no dedicated heap region).
+    TY_NUM_MEMORY_TAGS,        ///< The number of tags.
+} tinyMemoryTag;
+
+/**
+ * Represents the memory usage statistics of an allocator or of a tag.
+ *
+ * The byte counts include the rounding of the allocations by the allocator. They are zero when the heap is external
+ * (`TY_CONFIG_HEAP_EXTERNAL_ENABLE`), as the size of the allocations is then unknown when they are freed.
+ *
+ * Bucket `i` of the size histogram counts the allocations of at most `16 << i` bytes (and more than the previous
+ * bucket), and the last bucket counts all the larger ones.
+ */
+typedef struct tinyMemoryStats
+{
+    uint32_t mCapacityBytes;                           ///< Size of the allocator memory (zero if unknown).
+    uint32_t mCurrentBytes;                            ///< Number of bytes currently allocated.
+    uint32_t mPeakBytes;                               ///< Maximum number of bytes allocated (high-water mark).
+    uint32_t mNumAllocations;                          ///< Number of successful allocations.
+    uint32_t mNumFrees;                                ///< Number of frees.
+    uint32_t mNumFailures;                             ///< Number of failed allocations.
+    uint32_t mSizeHistogram[TY_MEMORY_HISTOGRAM_SIZE]; ///< Number of successful allocations by size.
+} tinyMemoryStats;
+
+/**
+ * Gets the memory usage statistics of an allocator.
+ *
+ * @param[in]  aInstance   A pointer to a Tiny instance.
+ * @param[in]  aAllocator  The allocator.
+ * @param[out] aStats      A pointer to output the statistics.
+ *
+ * @retval TY_ERROR_NONE          Successfully got the statistics.
+ * @retval TY_ERROR_NOT_FOUND     @p aAllocator is not used (mbedTLS is not managed by the library).
+ * @retval TY_ERROR_INVALID_ARGS  @p aAllocator is not valid.
+ */
+tinyError tinyMemoryGetAllocatorStats(tinyInstance *aInstance, tinyMemoryAllocator aAllocator, tinyMemoryStats *aStats);
+
+/**
+ * Gets the heap usage statistics of the allocations with a given tag.
+ *
+ * @param[in]  aInstance  A pointer to a Tiny instance.
+ * @param[in]  aTag       The tag.
+ * @param[out] aStats     A pointer to output the statistics (`mCapacityBytes` is zero).
+ *
+ * @retval TY_ERROR_NONE          Successfully got the statistics.
+ * @retval TY_ERROR_INVALID_ARGS  @p aTag is not valid.
+ */
+tinyError tinyMemoryGetTagStats(tinyInstance *aInstance, tinyMemoryTag aTag, tinyMemoryStats *aStats);
+
+/**
+ * Resets the high-water marks (`mPeakBytes`) of all the allocators and tags to their current number of bytes.
+ *
+ * @param[in]  aInstance  A pointer to a Tiny instance.
+ */
+void tinyMemoryResetPeaks(tinyInstance *aInstance);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // TY_MEMORY_H_
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief
+ *   This file includes platform abstractions for dynamic memory allocation.
+ */
+
+#ifndef TY_PLATFORM_MEMORY_H_
+#define TY_PLATFORM_MEMORY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup plat-memory
+ *
+ * @brief
+ *   This module includes platform abstractions for dynamic memory allocation.
+ *
+ * The allocation functions are used instead of the internal heap when `TY_CONFIG_HEAP_EXTERNAL_ENABLE` is set. The
+ * lock functions are used to protect the internal heap when `TY_CONFIG_HEAP_THREAD_SAFE_ENABLE` is set.
+ *
+ * @{
+ */
+
+/**
+ * Dynamically allocates new memory for an array of objects, with all bytes set to zero (same as `calloc()`).
+ *
+ * @param[in] aNum   The number of objects.
+ * @param[in] aSize  The size of each object (in bytes).
+ *
+ * @returns A pointer to the allocated memory, or `NULL` if it could not be allocated.
+ */
+void *tyPlatCAlloc(size_t aNum, size_t aSize);
+
+/**
+ * Changes the size of dynamically allocated memory, keeping its content (same as `realloc()`).
+ *
+ * @param[in] aPtr   A pointer to the memory (from `tyPlatCAlloc()` or `tyPlatRealloc()`), or `NULL`.
+ * @param[in] aSize  The new size (in bytes).
+ *
+ * @returns A pointer to the reallocated memory, or `NULL` if it could not be reallocated (@p aPtr is then unchanged).
+ */
+void *tyPlatRealloc(void *aPtr, size_t aSize);
+
+/**
+ * Frees dynamically allocated memory (same as `free()`).
+ *
+ * @param[in] aPtr  A pointer to the memory to free, or `NULL` (ignored).
+ */
+void tyPlatFree(void *aPtr);
+
+/**
+ * Locks the internal heap, waiting if it is locked by another thread.
+ *
+ * The heap operations are bounded in time and short, so a spin lock or a critical section can be used.
+ */
+void tyPlatHeapLock(void);
+
+/**
+ * Unlocks the internal heap (locked by `tyPlatHeapLock()`).
+ */
+void tyPlatHeapUnlock(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // TY_PLATFORM_MEMORY_H_
@@ -163,6 +163,25 @@ extern "C" {
     } while (false) /* fallthrough */
 #endif
 
+/**
+ * @def TY_TOOL_PREFETCH
+ *
+ * Hints the processor to fetch the cache line containing a given address ahead of its use (for reading).
+ *
+ * It never faults, but the address should still be within the object being accessed. Expands to nothing on toolchains
+ * (or targets) without a prefetch instruction.
+ *
+ * @param[in] aAddress  The address to prefetch.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define TY_TOOL_PREFETCH(aAddress) __builtin_prefetch(aAddress)
+#else
+#define TY_TOOL_PREFETCH(aAddress) \
+    do                             \
+    {                              \
+    } while (false)
+#endif
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
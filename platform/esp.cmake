@@ -1,6 +1,6 @@
 cmake_minimum_required(VERSION 3.20)
 
-idf_component_register()
+idf_component_register(PRIV_REQUIRES mbedtls)
 
 ty_library_named(tiny)
 ty_library_include_directories_public(${PROJECT_DIR}/include)
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the scoped arena (bump) allocator.
+ */
+
+#include "arena.hpp"
+
+#include <string.h>
+
+#include "common/heap.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/num_utils.hpp"
+
+namespace ty {
+
+Arena::Arena(void *aBuffer, size_t aSize, size_t aOverflowBlockSize)
+    : mBuffer(static_cast<uint8_t *>(aBuffer))
+    , mSize(aSize)
+    , mOverflowBlockSize(aOverflowBlockSize)
+    , mOverflow(nullptr)
+    , mCursor(mBuffer)
+    , mEnd(mBuffer + aSize)
+    , mUsedSize(0)
+    , mMaxUsedSize(0)
+{
+}
+
+void *Arena::Allocate(size_t aSize, size_t aAlignment)
+{
+    uint8_t  *pointer = nullptr;
+    uintptr_t cursor;
+    size_t    padding;
+
+    VerifyOrExit(aSize > 0);
+
+    cursor  = reinterpret_cast<uintptr_t>(mCursor);
+    padding = static_cast<size_t>(((cursor + aAlignment - 1) & ~(aAlignment - 1)) - cursor);
+
+    if ((padding > static_cast<size_t>(mEnd - mCursor)) || (aSize > static_cast<size_t>(mEnd - mCursor) - padding))
+    {
+        VerifyOrExit(AddOverflow(aSize, aAlignment));
+
+        cursor  = reinterpret_cast<uintptr_t>(mCursor);
+        padding = static_cast<size_t>(((cursor + aAlignment - 1) & ~(aAlignment - 1)) - cursor);
+    }
+
+    pointer = mCursor + padding;
+    mCursor = pointer + aSize;
+
+    mUsedSize += padding + aSize;
+    mMaxUsedSize = Max(mMaxUsedSize, mUsedSize);
+
+exit:
+    return pointer;
+}
+
+char *Arena::CopyString(const char *aString)
+{
+    size_t size = strlen(aString) + 1;
+    char  *copy = static_cast<char *>(Allocate(size, 1));
+
+    if (copy != nullptr)
+    {
+        memcpy(copy, aString, size);
+    }
+
+    return copy;
+}
+
+Arena::Marker Arena::Mark(void) const
+{
+    Marker marker;
+
+    marker.mOverflow = mOverflow;
+    marker.mCursor   = mCursor;
+    marker.mUsedSize = mUsedSize;
+
+    return marker;
+}
+
+void Arena::Rewind(const Marker &aMarker)
+{
+    while (mOverflow != aMarker.mOverflow)
+    {
+        Overflow *prev = mOverflow->mPrev;
+
+        Heap::Free(mOverflow, kMemoryTagArena);
+        mOverflow = prev;
+    }
+
+    if (mOverflow == nullptr)
+    {
+        mEnd = mBuffer + mSize;
+    }
+    else
+    {
+        mEnd = reinterpret_cast<uint8_t *>(mOverflow) + kOverflowHeaderSize + mOverflow->mSize;
+    }
+
+    mCursor   = aMarker.mCursor;
+    mUsedSize = aMarker.mUsedSize;
+}
+
+void Arena::Reset(void)
+{
+    Marker marker;
+
+    marker.mOverflow = nullptr;
+    marker.mCursor   = mBuffer;
+    marker.mUsedSize = 0;
+
+    Rewind(marker);
+}
+
+bool Arena::AddOverflow(size_t aSize, size_t aAlignment)
+{
+    // The block is large enough for the allocation at any alignment.
+    // The rest of the current buffer or block is left unused until
+    // the arena is rewound.
+
+    Overflow *overflow = nullptr;
+    size_t    size;
+
+    VerifyOrExit(mOverflowBlockSize > 0);
+    VerifyOrExit(aSize <= static_cast<size_t>(-1) - kOverflowHeaderSize - aAlignment);
+
+    size     = Max(mOverflowBlockSize, aSize + aAlignment - 1);
+    overflow = static_cast<Overflow *>(Heap::Allocate(kOverflowHeaderSize + size, kMemoryTagArena));
+    VerifyOrExit(overflow != nullptr);
+
+    overflow->mPrev = mOverflow;
+    overflow->mSize = size;
+
+    mOverflow = overflow;
+    mCursor   = reinterpret_cast<uint8_t *>(overflow) + kOverflowHeaderSize;
+    mEnd      = mCursor + size;
+
+exit:
+    return (overflow != nullptr);
+}
+
+} // namespace ty
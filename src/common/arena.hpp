@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for a scoped arena (bump) allocator.
+ */
+
+#ifndef ARENA_HPP_
+#define ARENA_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ty/common/new.hpp"
+#include "ty/common/non_copyable.hpp"
+#include "ty/common/type_traits.hpp"
+
+namespace ty {
+
+/**
+ * Implements an arena (bump) allocator for temporary memory, e.g., the scratch memory used while processing one
+ * request.
+ *
+ * Allocating only moves a cursor forward in the arena buffer, and the memory is never freed individually: it is
+ * released all at once by rewinding the arena to a mark taken before (see `Mark()` and `Rewind()`), typically using a
+ * `Scope` at the start of an operation. Objects created in the arena are not destroyed, so they MUST have trivial
+ * destructors (or not need to be destroyed).
+ *
+ * If an overflow block size is given, the arena chains additional blocks allocated from the heap (see `Heap`) when its
+ * buffer is full. These blocks are freed when the arena is rewound before them. The internal heap is enlarged by
+ * `TY_CONFIG_ARENA_OVERFLOW_HEAP_SIZE` bytes for them, which MUST be large enough for the blocks of all the arenas.
+ *
+ * `Arena` does not own its buffer, which is provided by the caller. `StaticArena` can be used to define an arena along
+ * with its buffer.
+ *
+ * @note `Arena` is not thread-safe.
+ */
+class Arena : private NonCopyable
+{
+    struct Overflow;
+
+public:
+    static constexpr size_t kDefaultAlignment = sizeof(uint64_t); ///< Default alignment of the allocated memory.
+
+    /**
+     * Represents a position in the arena, to rewind to.
+     */
+    class Marker
+    {
+        friend class Arena;
+
+        Overflow *mOverflow;
+        uint8_t  *mCursor;
+        size_t    mUsedSize;
+    };
+
+    /**
+     * Rewinds an arena to its position when the scope object was constructed, when it goes out of scope.
+     */
+    class Scope : private NonCopyable
+    {
+    public:
+        /**
+         * Initializes the scope, marking the current position of the arena.
+         *
+         * @param[in] aArena  The arena.
+         */
+        explicit Scope(Arena &aArena)
+            : mArena(aArena)
+            , mMarker(aArena.Mark())
+        {
+        }
+
+        /**
+         * Rewinds the arena to the position marked when the scope was constructed.
+         */
+        ~Scope(void) { mArena.Rewind(mMarker); }
+
+    private:
+        Arena &mArena;
+        Marker mMarker;
+    };
+
+    /**
+     * Initializes an empty arena on a provided buffer.
+     *
+     * @param[in] aBuffer             A pointer to the buffer.
+     * @param[in] aSize               The size of @p aBuffer (in bytes).
+     * @param[in] aOverflowBlockSize  The size of the blocks to allocate from the heap when the buffer is full (in
+     *                                bytes, larger blocks are allocated for larger allocations), or zero to never
+     *                                allocate from the heap.
+     */
+    Arena(void *aBuffer, size_t aSize, size_t aOverflowBlockSize = 0);
+
+    /**
+     * Frees the blocks allocated from the heap (if any).
+     */
+    ~Arena(void) { Reset(); }
+
+    /**
+     * Allocates memory from the arena.
+     *
+     * @param[in] aSize       The size to allocate (in bytes).
+     * @param[in] aAlignment  The alignment of the memory (MUST be a power of two).
+     *
+     * @returns A pointer to the allocated memory, or `nullptr` if @p aSize is zero or there is not enough space.
+     */
+    void *Allocate(size_t aSize, size_t aAlignment = kDefaultAlignment);
+
+    /**
+     * Allocates memory from the arena for an array of objects (which are not initialized).
+     *
+     * @tparam Type  The type of the objects.
+     *
+     * @param[in] aCount  The number of objects.
+     *
+     * @returns A pointer to the array, or `nullptr` if @p aCount is zero or there is not enough space.
+     */
+    template <typename Type> Type *AllocateArray(size_t aCount)
+    {
+        return (aCount > static_cast<size_t>(-1) / sizeof(Type))
+                   ? nullptr
+                   : static_cast<Type *>(Allocate(aCount * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * Creates an object in the arena.
+     *
+     * The object is never destroyed (its memory is released when the arena is rewound).
+     *
+     * @tparam Type  The type of the object.
+     * @tparam Args  The types of the arguments to pass to the constructor of `Type`.
+     *
+     * @param[in] aArgs  The arguments to pass to the constructor of `Type`.
+     *
+     * @returns A pointer to the object, or `nullptr` if there is not enough space.
+     */
+    template <typename Type, typename... Args> Type *New(Args &&...aArgs)
+    {
+        void *object = Allocate(sizeof(Type), alignof(Type));
+
+        return (object != nullptr) ? new (object) Type(Forward<Args>(aArgs)...) : nullptr;
+    }
+
+    /**
+     * Copies a null-terminated string to the arena.
+     *
+     * @param[in] aString  A pointer to the null-terminated string.
+     *
+     * @returns A pointer to the copy, or `nullptr` if there is not enough space.
+     */
+    char *CopyString(const char *aString);
+
+    /**
+     * Marks the current position of the arena, to rewind to it later.
+     *
+     * @returns The marker of the current position.
+     */
+    Marker Mark(void) const;
+
+    /**
+     * Rewinds the arena to a marked position, releasing all the memory allocated since.
+     *
+     * The marker MUST have been taken from this arena, and no rewind to an earlier position has happened since.
+     *
+     * @param[in] aMarker  The marker of the position (from `Mark()`).
+     */
+    void Rewind(const Marker &aMarker);
+
+    /**
+     * Rewinds the arena to its start, releasing all the allocated memory.
+     */
+    void Reset(void);
+
+    /**
+     * Returns the size of the memory currently allocated from the arena (including the alignment padding).
+     *
+     * @returns The allocated size (in bytes).
+     */
+    size_t GetUsedSize(void) const { return mUsedSize; }
+
+    /**
+     * Returns the maximum size of the memory allocated from the arena at the same time (high-water mark).
+     *
+     * @returns The maximum allocated size (in bytes).
+     */
+    size_t GetMaxUsedSize(void) const { return mMaxUsedSize; }
+
+private:
+    // An overflow block allocated from the heap, followed by its bytes.
+    struct Overflow
+    {
+        Overflow *mPrev;
+        size_t    mSize;
+    };
+
+    static constexpr size_t kOverflowHeaderSize = (sizeof(Overflow) + kDefaultAlignment - 1) & ~(kDefaultAlignment - 1);
+
+    bool AddOverflow(size_t aSize, size_t aAlignment);
+
+    uint8_t  *mBuffer;
+    size_t    mSize;
+    size_t    mOverflowBlockSize;
+    Overflow *mOverflow;
+    uint8_t  *mCursor;
+    uint8_t  *mEnd;
+    size_t    mUsedSize;
+    size_t    mMaxUsedSize;
+};
+
+/**
+ * Defines an `Arena` along with its buffer.
+ *
+ * @tparam kSize               The size of the arena buffer (in bytes).
+ * @tparam kOverflowBlockSize  The size of the blocks to allocate from the heap when the buffer is full (in bytes), or
+ *                             zero to never allocate from the heap.
+ */
+template <size_t kSize, size_t kOverflowBlockSize = 0> class StaticArena : public Arena
+{
+    static_assert(kSize > 0, "Arena cannot be empty");
+
+public:
+    /**
+     * Initializes the arena as empty.
+     */
+    StaticArena(void)
+        : Arena(mBuffer, kSize, kOverflowBlockSize)
+    {
+    }
+
+private:
+    alignas(uint64_t) uint8_t mBuffer[kSize];
+};
+
+} // namespace ty
+
+#endif // ARENA_HPP_
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the command line parser.
+ */
+
+#include "cmd_line_parser.hpp"
+
+namespace ty {
+
+Error CmdLineParser::Arg::ParseAsBool(bool &aBool) const
+{
+    static const char *const kTrueStrings[]  = {"1", "true", "on", "enable"};
+    static const char *const kFalseStrings[] = {"0", "false", "off", "disable"};
+
+    Error error = kErrorInvalidArgs;
+
+    VerifyOrExit(!IsEmpty());
+
+    for (const char *string : kTrueStrings)
+    {
+        if (StringMatch(mString, string, kStringCaseInsensitiveMatch))
+        {
+            aBool = true;
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+    for (const char *string : kFalseStrings)
+    {
+        if (StringMatch(mString, string, kStringCaseInsensitiveMatch))
+        {
+            aBool = false;
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error CmdLineParser::ParseCmd(char *aCommandString, Arg aArgs[], uint8_t aArgsMaxLength)
+{
+    Error   error = kErrorNone;
+    uint8_t index = 0;
+    char   *cur   = aCommandString;
+
+    while (true)
+    {
+        char *start;
+        char *write;
+        char  quote = kNullChar;
+
+        while (IsWhitespace(*cur))
+        {
+            cur++;
+        }
+
+        if (*cur == kNullChar)
+        {
+            break;
+        }
+
+        VerifyOrExit(index + 1 < aArgsMaxLength, error = kErrorInvalidArgs);
+
+        // Copy the argument characters backwards over any removed
+        // quote and escape characters. `write` never gets ahead of
+        // `cur`, so the characters are moved within the same buffer.
+
+        start = cur;
+        write = cur;
+
+        for (; *cur != kNullChar; cur++)
+        {
+            if ((quote == kNullChar) && IsWhitespace(*cur))
+            {
+                break;
+            }
+
+            if ((quote == kNullChar) && ((*cur == '"') || (*cur == '\'')))
+            {
+                quote = *cur;
+                continue;
+            }
+
+            if (*cur == quote)
+            {
+                quote = kNullChar;
+                continue;
+            }
+
+            if ((*cur == '\\') && (quote != '\'') && (cur[1] != kNullChar))
+            {
+                cur++;
+            }
+
+            *write++ = *cur;
+        }
+
+        VerifyOrExit(quote == kNullChar, error = kErrorParse);
+
+        if (*cur != kNullChar)
+        {
+            cur++;
+        }
+
+        *write = kNullChar;
+        aArgs[index++].Set(start, static_cast<uint16_t>(write - start));
+    }
+
+exit:
+    aArgs[index].Clear();
+    return error;
+}
+
+} // namespace ty
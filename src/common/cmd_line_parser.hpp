@@ -0,0 +1,348 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for the command line parser and command dispatcher.
+ */
+
+#ifndef CMD_LINE_PARSER_HPP_
+#define CMD_LINE_PARSER_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "common/string.hpp"
+#include "ty/common/binary_search.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/error.hpp"
+
+namespace ty {
+
+/**
+ * Implements parsing of a command line into arguments and dispatching of commands.
+ *
+ * The parser does not allocate and does not copy the command line. It splits the line in place: each argument is
+ * null-terminated within the original buffer, and quote and escape characters are removed by moving the remaining
+ * characters of the argument backwards.
+ */
+class CmdLineParser
+{
+public:
+    /**
+     * Represents a command line argument.
+     */
+    class Arg
+    {
+    public:
+        /**
+         * Clears the argument (marks it as empty).
+         */
+        void Clear(void) { Set(nullptr, 0); }
+
+        /**
+         * Indicates whether or not the argument is empty (does not contain any string).
+         *
+         * An empty argument marks the end of the argument list. Note that an argument with an empty string (e.g., from
+         * `""` on the command line) is not empty.
+         *
+         * @retval TRUE   The argument is empty.
+         * @retval FALSE  The argument is not empty.
+         */
+        bool IsEmpty(void) const { return (mString == nullptr); }
+
+        /**
+         * Returns the length of the argument string.
+         *
+         * @returns The argument string length (zero if the argument is empty).
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+        /**
+         * Returns the argument as a null-terminated C string.
+         *
+         * @returns A pointer to the argument string, or `nullptr` if the argument is empty.
+         */
+        const char *GetCString(void) const { return mString; }
+
+        /**
+         * Returns the argument as a string view.
+         *
+         * @returns The argument string view (an empty view if the argument is empty).
+         */
+        StringView GetStringView(void) const { return IsEmpty() ? StringView() : StringView(mString, mLength); }
+
+        /**
+         * Overloads operator `==` to evaluate whether the argument is equal to a given string.
+         *
+         * @param[in] aString  The string to compare with.
+         *
+         * @retval TRUE   The argument is not empty and is equal to @p aString.
+         * @retval FALSE  The argument is empty or is not equal to @p aString.
+         */
+        bool operator==(const StringView &aString) const
+        {
+            return !IsEmpty() && StringMatch(GetStringView(), aString);
+        }
+
+        /**
+         * Overloads operator `!=` to evaluate whether the argument is unequal to a given string.
+         *
+         * @param[in] aString  The string to compare with.
+         *
+         * @retval TRUE   The argument is empty or is not equal to @p aString.
+         * @retval FALSE  The argument is not empty and is equal to @p aString.
+         */
+        bool operator!=(const StringView &aString) const { return !(*this == aString); }
+
+        /**
+         * Parses the argument as a decimal `uint8_t` value.
+         *
+         * @param[out] aUint8  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsUint8(uint8_t &aUint8) const { return ParseAs(StringParseUint8, aUint8); }
+
+        /**
+         * Parses the argument as a decimal `uint16_t` value.
+         *
+         * @param[out] aUint16  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsUint16(uint16_t &aUint16) const { return ParseAs(StringParseUint16, aUint16); }
+
+        /**
+         * Parses the argument as a decimal `uint32_t` value.
+         *
+         * @param[out] aUint32  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsUint32(uint32_t &aUint32) const { return ParseAs(StringParseUint32, aUint32); }
+
+        /**
+         * Parses the argument as a decimal `uint64_t` value.
+         *
+         * @param[out] aUint64  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsUint64(uint64_t &aUint64) const { return ParseAs(StringParseUint64, aUint64); }
+
+        /**
+         * Parses the argument as a decimal `int8_t` value.
+         *
+         * @param[out] aInt8  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsInt8(int8_t &aInt8) const { return ParseAs(StringParseInt8, aInt8); }
+
+        /**
+         * Parses the argument as a decimal `int16_t` value.
+         *
+         * @param[out] aInt16  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsInt16(int16_t &aInt16) const { return ParseAs(StringParseInt16, aInt16); }
+
+        /**
+         * Parses the argument as a decimal `int32_t` value.
+         *
+         * @param[out] aInt32  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsInt32(int32_t &aInt32) const { return ParseAs(StringParseInt32, aInt32); }
+
+        /**
+         * Parses the argument as a hexadecimal `uint32_t` value (with an optional "0x" prefix).
+         *
+         * @param[out] aUint32  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or could not be parsed (as a whole).
+         */
+        Error ParseAsHexUint32(uint32_t &aUint32) const { return ParseAs(StringParseHexUint32, aUint32); }
+
+        /**
+         * Parses the argument as a boolean value.
+         *
+         * Accepts "1", "true", "on" and "enable" as `true`, and "0", "false", "off" and "disable" as `false`.
+         *
+         * @param[out] aBool  A reference to output the parsed value.
+         *
+         * @retval kErrorNone         Successfully parsed the value.
+         * @retval kErrorInvalidArgs  The argument is empty or is not a valid boolean value.
+         */
+        Error ParseAsBool(bool &aBool) const;
+
+    private:
+        friend class CmdLineParser;
+
+        template <typename ValueType>
+        Error ParseAs(Error (&aParser)(const char *&, ValueType &), ValueType &aValue) const
+        {
+            Error       error = kErrorInvalidArgs;
+            const char *cur   = mString;
+
+            VerifyOrExit(!IsEmpty());
+            SuccessOrExit(aParser(cur, aValue));
+            VerifyOrExit(*cur == kNullChar);
+            error = kErrorNone;
+
+        exit:
+            return error;
+        }
+
+        void Set(const char *aString, uint16_t aLength)
+        {
+            mString = aString;
+            mLength = aLength;
+        }
+
+        const char *mString;
+        uint16_t    mLength;
+    };
+
+    /**
+     * Represents an entry in a command table.
+     *
+     * A command table is a `constexpr` array of `Command` entries sorted by `mName`, which is verified using
+     * `static_assert(BinarySearch::IsSorted(kTable), ...)`. The command names MUST only contain ASCII characters.
+     *
+     * @tparam Owner  The type of the object providing the command handlers.
+     */
+    template <typename Owner> struct Command
+    {
+        /**
+         * Represents a command handler.
+         *
+         * @param[in] aArgs  The command arguments (excluding the command name), terminated by an empty `Arg`.
+         *
+         * @returns The error from the command.
+         */
+        typedef Error (Owner::*Handler)(Arg aArgs[]);
+
+        /**
+         * Compares the command name with a given name.
+         *
+         * @param[in] aName  The name to compare with.
+         *
+         * @returns The comparison result (similar to `strcmp()`) between @p aName and the command name.
+         */
+        int Compare(const StringView &aName) const { return StringCompare(aName, StringView(mName)); }
+
+        /**
+         * Indicates whether two command entries are in order (used to verify the table is sorted).
+         *
+         * @param[in] aFirst   The first entry.
+         * @param[in] aSecond  The second entry.
+         *
+         * @retval TRUE   If @p aFirst is ordered before @p aSecond.
+         * @retval FALSE  If @p aFirst is not ordered before @p aSecond.
+         */
+        constexpr static bool AreInOrder(const Command &aFirst, const Command &aSecond)
+        {
+            return AreStringsInOrder(aFirst.mName, aSecond.mName);
+        }
+
+        const char *mName;    ///< The command name.
+        Handler     mHandler; ///< The command handler.
+    };
+
+    /**
+     * Parses a command line into arguments, in place.
+     *
+     * The arguments are separated by whitespace characters. Within an argument:
+     *
+     * - Characters enclosed in double quotes (`"`) or single quotes (`'`) are taken as they are, including whitespace
+     *   characters. The quote characters are removed.
+     * - A backslash (`\`) outside single quotes escapes the next character, which is taken as it is. The backslash is
+     *   removed.
+     *
+     * The command line buffer is modified: each argument is null-terminated in place and quote and escape characters
+     * are removed from it. The entry after the last argument in @p aArgs is cleared to mark the end of the list.
+     *
+     * @param[in,out] aCommandString   A pointer to the null-terminated command line to parse.
+     * @param[out]    aArgs            A pointer to an array of arguments to output the parsed arguments.
+     * @param[in]     aArgsMaxLength   The number of entries in @p aArgs (MUST be at least one). As the last entry is
+     *                                 always cleared, at most `aArgsMaxLength - 1` arguments can be parsed.
+     *
+     * @retval kErrorNone         Successfully parsed the command line.
+     * @retval kErrorInvalidArgs  There are too many arguments.
+     * @retval kErrorParse        A quote is not closed.
+     */
+    static Error ParseCmd(char *aCommandString, Arg aArgs[], uint8_t aArgsMaxLength);
+
+    /**
+     * Parses a command line into arguments, in place.
+     *
+     * @sa ParseCmd(char *aCommandString, Arg aArgs[], uint8_t aArgsMaxLength)
+     *
+     * @tparam kLength  The length of the @p aArgs array.
+     *
+     * @param[in,out] aCommandString   A pointer to the null-terminated command line to parse.
+     * @param[out]    aArgs            A reference to an array of arguments to output the parsed arguments.
+     *
+     * @retval kErrorNone         Successfully parsed the command line.
+     * @retval kErrorInvalidArgs  There are too many arguments.
+     * @retval kErrorParse        A quote is not closed.
+     */
+    template <uint8_t kLength> static Error ParseCmd(char *aCommandString, Arg (&aArgs)[kLength])
+    {
+        static_assert(kLength > 0, "Args array cannot be empty");
+
+        return ParseCmd(aCommandString, aArgs, kLength);
+    }
+
+    /**
+     * Dispatches a command to its handler from a given command table.
+     *
+     * The command is looked up by its name (the first argument in @p aArgs) using binary search, and its handler is
+     * invoked on @p aOwner with the remaining arguments.
+     *
+     * @tparam Owner    The type of the object providing the command handlers.
+     * @tparam kLength  The number of entries in the command table.
+     *
+     * @param[in] aOwner  The object to invoke the command handler on.
+     * @param[in] aTable  The sorted command table.
+     * @param[in] aArgs   The arguments (the command name followed by the command arguments), as parsed by
+     *                    `ParseCmd()`.
+     *
+     * @retval kErrorNotFound     The command is not in @p aTable.
+     * @retval kErrorInvalidArgs  There is no command name in @p aArgs.
+     * @returns The error from the command handler, otherwise.
+     */
+    template <typename Owner, uint16_t kLength>
+    static Error Dispatch(Owner &aOwner, const Command<Owner> (&aTable)[kLength], Arg aArgs[])
+    {
+        Error                 error = kErrorNone;
+        const Command<Owner> *command;
+
+        VerifyOrExit(!aArgs[0].IsEmpty(), error = kErrorInvalidArgs);
+
+        command = BinarySearch::Find(aArgs[0].GetStringView(), aTable);
+        VerifyOrExit(command != nullptr, error = kErrorNotFound);
+
+        error = (aOwner.*command->mHandler)(aArgs + 1);
+
+    exit:
+        return error;
+    }
+};
+
+} // namespace ty
+
+#endif // CMD_LINE_PARSER_HPP_
@@ -0,0 +1,279 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements hex and Base64 encoding and decoding of binary data.
+ */
+
+#include "encoding.hpp"
+
+#include "ty/common/code_utils.hpp"
+
+namespace ty {
+
+namespace {
+
+// The decoders map each input character to its value using a
+// 256-entry table. Invalid characters map to `kInvalidValue`,
+// whose high bit is never set by a valid value. The values of all
+// characters are OR-ed together and checked once at the end, so
+// the decode loops have no per-character branches.
+
+constexpr uint8_t kInvalidValue = 0xff;
+constexpr uint8_t kInvalidBit   = 0x80;
+
+constexpr char kHexDigits[]          = "0123456789abcdef";
+constexpr char kHexUppercaseDigits[] = "ABCDEF";
+constexpr char kBase64Alphabet[]     = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr char kBase64UrlAlphabet[]  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+constexpr char kBase64PadChar        = '=';
+
+struct DecodeTable
+{
+    uint8_t mValues[256];
+};
+
+constexpr void AddToDecodeTable(DecodeTable &aTable, const char *aAlphabet, uint8_t aFirstValue)
+{
+    for (uint8_t index = 0; aAlphabet[index] != kNullChar; index++)
+    {
+        aTable.mValues[static_cast<uint8_t>(aAlphabet[index])] = static_cast<uint8_t>(aFirstValue + index);
+    }
+}
+
+constexpr DecodeTable MakeDecodeTable(const char *aAlphabet, const char *aAlternateAlphabet = "")
+{
+    DecodeTable table = {};
+
+    for (uint8_t &value : table.mValues)
+    {
+        value = kInvalidValue;
+    }
+
+    AddToDecodeTable(table, aAlphabet, 0);
+    AddToDecodeTable(table, aAlternateAlphabet, 10);
+
+    return table;
+}
+
+constexpr DecodeTable kHexDecodeTable       = MakeDecodeTable(kHexDigits, kHexUppercaseDigits);
+constexpr DecodeTable kBase64DecodeTable    = MakeDecodeTable(kBase64Alphabet);
+constexpr DecodeTable kBase64UrlDecodeTable = MakeDecodeTable(kBase64UrlAlphabet);
+
+static_assert(kHexDecodeTable.mValues['F'] == 15, "Hex decode table is incorrect");
+static_assert(kBase64DecodeTable.mValues['/'] == 63, "Base64 decode table is incorrect");
+static_assert(kBase64UrlDecodeTable.mValues['_'] == 63, "Base64URL decode table is incorrect");
+
+Error EncodeBase64(const uint8_t *aBytes,
+                   uint16_t       aLength,
+                   char          *aString,
+                   uint16_t       aSize,
+                   const char    *aAlphabet,
+                   bool           aWithPadding)
+{
+    // Encodes each three bytes (24 bits) as four characters (6 bits
+    // each). A final partial group of one or two bytes gives two or
+    // three characters, followed by padding if `aWithPadding`.
+
+    Error error = kErrorNone;
+
+    VerifyOrExit(Base64EncodedLength(aLength, aWithPadding) < aSize, error = kErrorNoBufs);
+
+    for (; aLength >= 3; aLength -= 3, aBytes += 3)
+    {
+        uint32_t group = (static_cast<uint32_t>(aBytes[0]) << 16) | (static_cast<uint32_t>(aBytes[1]) << 8) | aBytes[2];
+
+        *aString++ = aAlphabet[(group >> 18) & 0x3f];
+        *aString++ = aAlphabet[(group >> 12) & 0x3f];
+        *aString++ = aAlphabet[(group >> 6) & 0x3f];
+        *aString++ = aAlphabet[group & 0x3f];
+    }
+
+    if (aLength > 0)
+    {
+        uint32_t group = static_cast<uint32_t>(aBytes[0]) << 16;
+
+        if (aLength > 1)
+        {
+            group |= static_cast<uint32_t>(aBytes[1]) << 8;
+        }
+
+        *aString++ = aAlphabet[(group >> 18) & 0x3f];
+        *aString++ = aAlphabet[(group >> 12) & 0x3f];
+
+        if (aLength > 1)
+        {
+            *aString++ = aAlphabet[(group >> 6) & 0x3f];
+        }
+        else if (aWithPadding)
+        {
+            *aString++ = kBase64PadChar;
+        }
+
+        if (aWithPadding)
+        {
+            *aString++ = kBase64PadChar;
+        }
+    }
+
+    *aString = kNullChar;
+
+exit:
+    return error;
+}
+
+Error DecodeBase64(const StringView  &aString,
+                   uint8_t           *aBytes,
+                   uint16_t           aSize,
+                   uint16_t          &aLength,
+                   const DecodeTable &aTable,
+                   bool               aRequirePadding)
+{
+    // Decodes each four characters into three bytes. A final partial
+    // group of two or three characters gives one or two bytes, and
+    // the unused (low) bits of its last character must be zero.
+
+    Error          error       = kErrorNone;
+    const uint8_t *cur         = reinterpret_cast<const uint8_t *>(aString.GetString());
+    uint16_t       length      = aString.GetLength();
+    uint8_t        numPadChars = 0;
+    uint8_t        invalid     = 0;
+    uint16_t       decodedLength;
+    uint8_t        remainder;
+
+    while ((numPadChars < 2) && (length > 0) && (cur[length - 1] == kBase64PadChar))
+    {
+        length--;
+        numPadChars++;
+    }
+
+    if (aRequirePadding || (numPadChars > 0))
+    {
+        VerifyOrExit(((length + numPadChars) % 4) == 0, error = kErrorParse);
+    }
+
+    remainder = static_cast<uint8_t>(length % 4);
+    VerifyOrExit(remainder != 1, error = kErrorParse);
+
+    decodedLength = static_cast<uint16_t>((length / 4) * 3 + ((remainder > 0) ? remainder - 1 : 0));
+    VerifyOrExit(decodedLength <= aSize, error = kErrorNoBufs);
+
+    for (; length >= 4; length -= 4, cur += 4)
+    {
+        uint8_t  a     = aTable.mValues[cur[0]];
+        uint8_t  b     = aTable.mValues[cur[1]];
+        uint8_t  c     = aTable.mValues[cur[2]];
+        uint8_t  d     = aTable.mValues[cur[3]];
+        uint32_t group = (static_cast<uint32_t>(a) << 18) | (static_cast<uint32_t>(b) << 12) |
+                         (static_cast<uint32_t>(c) << 6) | d;
+
+        invalid |= a | b | c | d;
+
+        *aBytes++ = static_cast<uint8_t>(group >> 16);
+        *aBytes++ = static_cast<uint8_t>(group >> 8);
+        *aBytes++ = static_cast<uint8_t>(group);
+    }
+
+    if (remainder > 0)
+    {
+        uint8_t  a     = aTable.mValues[cur[0]];
+        uint8_t  b     = aTable.mValues[cur[1]];
+        uint32_t group = (static_cast<uint32_t>(a) << 18) | (static_cast<uint32_t>(b) << 12);
+
+        invalid |= a | b;
+
+        if (remainder == 3)
+        {
+            uint8_t c = aTable.mValues[cur[2]];
+
+            invalid |= c;
+            group |= static_cast<uint32_t>(c) << 6;
+        }
+
+        *aBytes++ = static_cast<uint8_t>(group >> 16);
+
+        if (remainder == 3)
+        {
+            *aBytes++ = static_cast<uint8_t>(group >> 8);
+        }
+
+        VerifyOrExit((group & ((remainder == 3) ? 0xff : 0xffff)) == 0, error = kErrorParse);
+    }
+
+    VerifyOrExit((invalid & kInvalidBit) == 0, error = kErrorParse);
+
+    aLength = decodedLength;
+
+exit:
+    return error;
+}
+
+} // namespace
+
+Error HexEncode(const uint8_t *aBytes, uint16_t aLength, char *aString, uint16_t aSize)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(HexEncodedLength(aLength) < aSize, error = kErrorNoBufs);
+
+    for (; aLength > 0; aLength--, aBytes++)
+    {
+        *aString++ = kHexDigits[*aBytes >> 4];
+        *aString++ = kHexDigits[*aBytes & 0x0f];
+    }
+
+    *aString = kNullChar;
+
+exit:
+    return error;
+}
+
+Error HexDecode(const StringView &aString, uint8_t *aBytes, uint16_t aSize, uint16_t &aLength)
+{
+    Error          error   = kErrorNone;
+    const uint8_t *cur     = reinterpret_cast<const uint8_t *>(aString.GetString());
+    uint16_t       length  = aString.GetLength();
+    uint8_t        invalid = 0;
+
+    VerifyOrExit((length % 2) == 0, error = kErrorParse);
+    VerifyOrExit(length / 2 <= aSize, error = kErrorNoBufs);
+
+    for (uint16_t count = length / 2; count > 0; count--, cur += 2)
+    {
+        uint8_t high = kHexDecodeTable.mValues[cur[0]];
+        uint8_t low  = kHexDecodeTable.mValues[cur[1]];
+
+        invalid |= high | low;
+        *aBytes++ = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    VerifyOrExit((invalid & kInvalidBit) == 0, error = kErrorParse);
+
+    aLength = length / 2;
+
+exit:
+    return error;
+}
+
+Error Base64Encode(const uint8_t *aBytes, uint16_t aLength, char *aString, uint16_t aSize)
+{
+    return EncodeBase64(aBytes, aLength, aString, aSize, kBase64Alphabet, /* aWithPadding */ true);
+}
+
+Error Base64Decode(const StringView &aString, uint8_t *aBytes, uint16_t aSize, uint16_t &aLength)
+{
+    return DecodeBase64(aString, aBytes, aSize, aLength, kBase64DecodeTable, /* aRequirePadding */ true);
+}
+
+Error Base64UrlEncode(const uint8_t *aBytes, uint16_t aLength, char *aString, uint16_t aSize)
+{
+    return EncodeBase64(aBytes, aLength, aString, aSize, kBase64UrlAlphabet, /* aWithPadding */ false);
+}
+
+Error Base64UrlDecode(const StringView &aString, uint8_t *aBytes, uint16_t aSize, uint16_t &aLength)
+{
+    return DecodeBase64(aString, aBytes, aSize, aLength, kBase64UrlDecodeTable, /* aRequirePadding */ false);
+}
+
+} // namespace ty
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for hex and Base64 encoding and decoding of binary data.
+ */
+
+#ifndef ENCODING_HPP_
+#define ENCODING_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "common/string.hpp"
+#include "ty/common/error.hpp"
+
+namespace ty {
+
+/**
+ * Returns the number of characters (excluding the null character) to encode a given number of bytes in hex.
+ *
+ * @param[in] aLength  The number of bytes.
+ *
+ * @returns The hex encoded length.
+ */
+constexpr uint32_t HexEncodedLength(uint16_t aLength)
+{
+    return 2 * static_cast<uint32_t>(aLength);
+}
+
+/**
+ * Returns the number of characters (excluding the null character) to encode a given number of bytes in Base64.
+ *
+ * @param[in] aLength       The number of bytes.
+ * @param[in] aWithPadding  Whether the encoding is padded with '=' characters (as `Base64Encode()`) or not (as
+ *                          `Base64UrlEncode()`).
+ *
+ * @returns The Base64 encoded length.
+ */
+constexpr uint32_t Base64EncodedLength(uint16_t aLength, bool aWithPadding = true)
+{
+    return aWithPadding ? ((static_cast<uint32_t>(aLength) + 2) / 3) * 4 : (static_cast<uint32_t>(aLength) * 4 + 2) / 3;
+}
+
+/**
+ * Encodes bytes in hex (using lowercase digits).
+ *
+ * @param[in]  aBytes   A pointer to the bytes to encode.
+ * @param[in]  aLength  The number of bytes in @p aBytes.
+ * @param[out] aString  A pointer to a buffer to output the encoded null-terminated string.
+ * @param[in]  aSize    The size of @p aString (MUST be at least `HexEncodedLength(aLength) + 1`).
+ *
+ * @retval kErrorNone    Successfully encoded the bytes.
+ * @retval kErrorNoBufs  The @p aString buffer is too small.
+ */
+Error HexEncode(const uint8_t *aBytes, uint16_t aLength, char *aString, uint16_t aSize);
+
+/**
+ * Decodes a hex string into bytes.
+ *
+ * Both uppercase and lowercase digits are accepted. The string MUST contain an even number of hex digits and no other
+ * characters.
+ *
+ * @param[in]  aString  The hex string to decode.
+ * @param[out] aBytes   A pointer to a buffer to output the decoded bytes.
+ * @param[in]  aSize    The size of @p aBytes (in bytes).
+ * @param[out] aLength  A reference to output the number of decoded bytes.
+ *
+ * @retval kErrorNone    Successfully decoded the string.
+ * @retval kErrorParse   The string is not valid hex. The @p aBytes buffer may be partially written.
+ * @retval kErrorNoBufs  The @p aBytes buffer is too small.
+ */
+Error HexDecode(const StringView &aString, uint8_t *aBytes, uint16_t aSize, uint16_t &aLength);
+
+/**
+ * Encodes bytes in Base64 (RFC 4648, section 4) with '=' padding.
+ *
+ * @param[in]  aBytes   A pointer to the bytes to encode.
+ * @param[in]  aLength  The number of bytes in @p aBytes.
+ * @param[out] aString  A pointer to a buffer to output the encoded null-terminated string.
+ * @param[in]  aSize    The size of @p aString (MUST be at least `Base64EncodedLength(aLength) + 1`).
+ *
+ * @retval kErrorNone    Successfully encoded the bytes.
+ * @retval kErrorNoBufs  The @p aString buffer is too small.
+ */
+Error Base64Encode(const uint8_t *aBytes, uint16_t aLength, char *aString, uint16_t aSize);
+
+/**
+ * Decodes a Base64 (RFC 4648, section 4) string into bytes.
+ *
+ * The string MUST be padded with '=' characters to a multiple of four characters, and MUST not contain any other
+ * characters (e.g., whitespace). The unused bits of the last character MUST be zero.
+ *
+ * @param[in]  aString  The Base64 string to decode.
+ * @param[out] aBytes   A pointer to a buffer to output the decoded bytes.
+ * @param[in]  aSize    The size of @p aBytes (in bytes).
+ * @param[out] aLength  A reference to output the number of decoded bytes.
+ *
+ * @retval kErrorNone    Successfully decoded the string.
+ * @retval kErrorParse   The string is not valid Base64. The @p aBytes buffer may be partially written.
+ * @retval kErrorNoBufs  The @p aBytes buffer is too small.
+ */
+Error Base64Decode(const StringView &aString, uint8_t *aBytes, uint16_t aSize, uint16_t &aLength);
+
+/**
+ * Encodes bytes in Base64URL (RFC 4648, section 5, the URL and filename safe alphabet) without padding.
+ *
+ * @param[in]  aBytes   A pointer to the bytes to encode.
+ * @param[in]  aLength  The number of bytes in @p aBytes.
+ * @param[out] aString  A pointer to a buffer to output the encoded null-terminated string.
+ * @param[in]  aSize    The size of @p aString (MUST be at least `Base64EncodedLength(aLength, false) + 1`).
+ *
+ * @retval kErrorNone    Successfully encoded the bytes.
+ * @retval kErrorNoBufs  The @p aString buffer is too small.
+ */
+Error Base64UrlEncode(const uint8_t *aBytes, uint16_t aLength, char *aString, uint16_t aSize);
+
+/**
+ * Decodes a Base64URL (RFC 4648, section 5) string into bytes.
+ *
+ * The '=' padding is optional, but if present the string length MUST be a multiple of four characters. The unused bits
+ * of the last character MUST be zero.
+ *
+ * @param[in]  aString  The Base64URL string to decode.
+ * @param[out] aBytes   A pointer to a buffer to output the decoded bytes.
+ * @param[in]  aSize    The size of @p aBytes (in bytes).
+ * @param[out] aLength  A reference to output the number of decoded bytes.
+ *
+ * @retval kErrorNone    Successfully decoded the string.
+ * @retval kErrorParse   The string is not valid Base64URL. The @p aBytes buffer may be partially written.
+ * @retval kErrorNoBufs  The @p aBytes buffer is too small.
+ */
+Error Base64UrlDecode(const StringView &aString, uint8_t *aBytes, uint16_t aSize, uint16_t &aLength);
+
+} // namespace ty
+
+#endif // ENCODING_HPP_
@@ -0,0 +1,637 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements formatting of floating-point values without libc `printf()`.
+ */
+
+#include "float_format.hpp"
+
+#include <string.h>
+
+#include "ty/common/array.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/debug.hpp"
+
+namespace ty {
+
+namespace {
+
+// The digit generation follows the Grisu2 algorithm from F. Loitsch,
+// "Printing Floating-Point Numbers Quickly and Accurately with
+// Integers" (PLDI 2010).
+
+struct DiyFp
+{
+    // A floating-point value `mSignificand * 2^mExponent` with a
+    // 64-bit significand and no implicit bits.
+
+    DiyFp(uint64_t aSignificand, int aExponent)
+        : mSignificand(aSignificand)
+        , mExponent(aExponent)
+    {
+    }
+
+    void Normalize(void)
+    {
+        // Shifts the significand so that its top bit is set.
+
+        while ((mSignificand & 0xff00000000000000ull) == 0)
+        {
+            mSignificand <<= 8;
+            mExponent -= 8;
+        }
+
+        while ((mSignificand & 0x8000000000000000ull) == 0)
+        {
+            mSignificand <<= 1;
+            mExponent--;
+        }
+    }
+
+    DiyFp operator*(const DiyFp &aOther) const
+    {
+        // Returns the upper 64 bits of the 128-bit product (rounded),
+        // using 32-bit halves so that no 128-bit type is needed.
+
+        static constexpr uint64_t kMask32 = 0xffffffffull;
+
+        uint64_t a   = mSignificand >> 32;
+        uint64_t b   = mSignificand & kMask32;
+        uint64_t c   = aOther.mSignificand >> 32;
+        uint64_t d   = aOther.mSignificand & kMask32;
+        uint64_t ac  = a * c;
+        uint64_t bc  = b * c;
+        uint64_t ad  = a * d;
+        uint64_t bd  = b * d;
+        uint64_t mid = (bd >> 32) + (ad & kMask32) + (bc & kMask32) + (1ull << 31);
+
+        return DiyFp(ac + (ad >> 32) + (bc >> 32) + (mid >> 32), mExponent + aOther.mExponent + 64);
+    }
+
+    uint64_t mSignificand;
+    int      mExponent;
+};
+
+struct CachedPower
+{
+    uint64_t mSignificand;
+    int16_t  mExponent;
+};
+
+// Normalized (rounded) powers `10^k` for `k` from -348 to 340 in
+// steps of 8.
+
+constexpr int kCachedPowersMinDecimalExponent = -348;
+constexpr int kCachedPowersDecimalExponentStep = 8;
+
+const CachedPower kCachedPowers[] = {
+    {0xfa8fd5a0081c0288ull, -1220}, // 1e-348
+    {0xbaaee17fa23ebf76ull, -1193}, // 1e-340
+    {0x8b16fb203055ac76ull, -1166}, // 1e-332
+    {0xcf42894a5dce35eaull, -1140}, // 1e-324
+    {0x9a6bb0aa55653b2dull, -1113}, // 1e-316
+    {0xe61acf033d1a45dfull, -1087}, // 1e-308
+    {0xab70fe17c79ac6caull, -1060}, // 1e-300
+    {0xff77b1fcbebcdc4full, -1034}, // 1e-292
+    {0xbe5691ef416bd60cull, -1007}, // 1e-284
+    {0x8dd01fad907ffc3cull, -980}, // 1e-276
+    {0xd3515c2831559a83ull, -954}, // 1e-268
+    {0x9d71ac8fada6c9b5ull, -927}, // 1e-260
+    {0xea9c227723ee8bcbull, -901}, // 1e-252
+    {0xaecc49914078536dull, -874}, // 1e-244
+    {0x823c12795db6ce57ull, -847}, // 1e-236
+    {0xc21094364dfb5637ull, -821}, // 1e-228
+    {0x9096ea6f3848984full, -794}, // 1e-220
+    {0xd77485cb25823ac7ull, -768}, // 1e-212
+    {0xa086cfcd97bf97f4ull, -741}, // 1e-204
+    {0xef340a98172aace5ull, -715}, // 1e-196
+    {0xb23867fb2a35b28eull, -688}, // 1e-188
+    {0x84c8d4dfd2c63f3bull, -661}, // 1e-180
+    {0xc5dd44271ad3cdbaull, -635}, // 1e-172
+    {0x936b9fcebb25c996ull, -608}, // 1e-164
+    {0xdbac6c247d62a584ull, -582}, // 1e-156
+    {0xa3ab66580d5fdaf6ull, -555}, // 1e-148
+    {0xf3e2f893dec3f126ull, -529}, // 1e-140
+    {0xb5b5ada8aaff80b8ull, -502}, // 1e-132
+    {0x87625f056c7c4a8bull, -475}, // 1e-124
+    {0xc9bcff6034c13053ull, -449}, // 1e-116
+    {0x964e858c91ba2655ull, -422}, // 1e-108
+    {0xdff9772470297ebdull, -396}, // 1e-100
+    {0xa6dfbd9fb8e5b88full, -369}, // 1e-92
+    {0xf8a95fcf88747d94ull, -343}, // 1e-84
+    {0xb94470938fa89bcfull, -316}, // 1e-76
+    {0x8a08f0f8bf0f156bull, -289}, // 1e-68
+    {0xcdb02555653131b6ull, -263}, // 1e-60
+    {0x993fe2c6d07b7facull, -236}, // 1e-52
+    {0xe45c10c42a2b3b06ull, -210}, // 1e-44
+    {0xaa242499697392d3ull, -183}, // 1e-36
+    {0xfd87b5f28300ca0eull, -157}, // 1e-28
+    {0xbce5086492111aebull, -130}, // 1e-20
+    {0x8cbccc096f5088ccull, -103}, // 1e-12
+    {0xd1b71758e219652cull, -77}, // 1e-4
+    {0x9c40000000000000ull, -50}, // 1e4
+    {0xe8d4a51000000000ull, -24}, // 1e12
+    {0xad78ebc5ac620000ull, 3}, // 1e20
+    {0x813f3978f8940984ull, 30}, // 1e28
+    {0xc097ce7bc90715b3ull, 56}, // 1e36
+    {0x8f7e32ce7bea5c70ull, 83}, // 1e44
+    {0xd5d238a4abe98068ull, 109}, // 1e52
+    {0x9f4f2726179a2245ull, 136}, // 1e60
+    {0xed63a231d4c4fb27ull, 162}, // 1e68
+    {0xb0de65388cc8ada8ull, 189}, // 1e76
+    {0x83c7088e1aab65dbull, 216}, // 1e84
+    {0xc45d1df942711d9aull, 242}, // 1e92
+    {0x924d692ca61be758ull, 269}, // 1e100
+    {0xda01ee641a708deaull, 295}, // 1e108
+    {0xa26da3999aef774aull, 322}, // 1e116
+    {0xf209787bb47d6b85ull, 348}, // 1e124
+    {0xb454e4a179dd1877ull, 375}, // 1e132
+    {0x865b86925b9bc5c2ull, 402}, // 1e140
+    {0xc83553c5c8965d3dull, 428}, // 1e148
+    {0x952ab45cfa97a0b3ull, 455}, // 1e156
+    {0xde469fbd99a05fe3ull, 481}, // 1e164
+    {0xa59bc234db398c25ull, 508}, // 1e172
+    {0xf6c69a72a3989f5cull, 534}, // 1e180
+    {0xb7dcbf5354e9beceull, 561}, // 1e188
+    {0x88fcf317f22241e2ull, 588}, // 1e196
+    {0xcc20ce9bd35c78a5ull, 614}, // 1e204
+    {0x98165af37b2153dfull, 641}, // 1e212
+    {0xe2a0b5dc971f303aull, 667}, // 1e220
+    {0xa8d9d1535ce3b396ull, 694}, // 1e228
+    {0xfb9b7cd9a4a7443cull, 720}, // 1e236
+    {0xbb764c4ca7a44410ull, 747}, // 1e244
+    {0x8bab8eefb6409c1aull, 774}, // 1e252
+    {0xd01fef10a657842cull, 800}, // 1e260
+    {0x9b10a4e5e9913129ull, 827}, // 1e268
+    {0xe7109bfba19c0c9dull, 853}, // 1e276
+    {0xac2820d9623bf429ull, 880}, // 1e284
+    {0x80444b5e7aa7cf85ull, 907}, // 1e292
+    {0xbf21e44003acdd2dull, 933}, // 1e300
+    {0x8e679c2f5e44ff8full, 960}, // 1e308
+    {0xd433179d9c8cb841ull, 986}, // 1e316
+    {0x9e19db92b4e31ba9ull, 1013}, // 1e324
+    {0xeb96bf6ebadf77d9ull, 1039}, // 1e332
+    {0xaf87023b9bf0ee6bull, 1066}, // 1e340
+};
+
+const uint64_t kPowersOfTen[] = {
+    1ull,
+    10ull,
+    100ull,
+    1000ull,
+    10000ull,
+    100000ull,
+    1000000ull,
+    10000000ull,
+    100000000ull,
+    1000000000ull,
+    10000000000ull,
+    100000000000ull,
+    1000000000000ull,
+    10000000000000ull,
+    100000000000000ull,
+    1000000000000000ull,
+    10000000000000000ull,
+    100000000000000000ull,
+    1000000000000000000ull,
+    10000000000000000000ull,
+};
+
+int FloorLog10Pow2(int aExponent)
+{
+    // Returns `floor(aExponent * log10(2))` using the fixed-point
+    // approximation `78913 / 2^18` (exact for |aExponent| <= 1650).
+
+    return (aExponent >= 0) ? ((aExponent * 78913) >> 18) : -(((-aExponent * 78913) + (1 << 18) - 1) >> 18);
+}
+
+DiyFp GetCachedPower(int aExponent, int &aDecimalExponent)
+{
+    // Selects the cached power `c = 10^-k` such that the product of
+    // a normalized value with binary exponent `aExponent` and `c`
+    // has a binary exponent in [-60, -32], so that its integral part
+    // fits in 32 bits. `aDecimalExponent` is set to `k`.
+
+    int      power = -61 - aExponent;
+    int      k     = ((power != 0) ? FloorLog10Pow2(power) + 1 : 0) - kCachedPowersMinDecimalExponent - 1;
+    uint16_t index = static_cast<uint16_t>((k / kCachedPowersDecimalExponentStep) + 1);
+
+    TY_ASSERT(index < GetArrayLength(kCachedPowers));
+
+    aDecimalExponent = -(kCachedPowersMinDecimalExponent + index * kCachedPowersDecimalExponentStep);
+
+    return DiyFp(kCachedPowers[index].mSignificand, kCachedPowers[index].mExponent);
+}
+
+uint8_t CountDecimalDigits(uint32_t aValue)
+{
+    uint8_t count = 1;
+
+    while ((count < 10) && (aValue >= kPowersOfTen[count]))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void RoundLastDigit(char    *aDigits,
+                    uint8_t  aNumDigits,
+                    uint64_t aDelta,
+                    uint64_t aRest,
+                    uint64_t aTenKappa,
+                    uint64_t aDistance)
+{
+    // Moves the last digit down (towards the scaled value) while the
+    // result stays within the rounding interval and gets closer to
+    // the value. `aDistance` is the distance from the value to the
+    // upper boundary, `aRest` the distance from the digits to the
+    // upper boundary.
+
+    while ((aRest < aDistance) && (aDelta - aRest >= aTenKappa) &&
+           ((aRest + aTenKappa < aDistance) || (aDistance - aRest > aRest + aTenKappa - aDistance)))
+    {
+        aDigits[aNumDigits - 1]--;
+        aRest += aTenKappa;
+    }
+}
+
+void GenerateShortestDigits(const DiyFp &aValue,
+                            const DiyFp &aUpper,
+                            uint64_t     aDelta,
+                            char        *aDigits,
+                            uint8_t     &aNumDigits,
+                            int         &aDecimalExponent)
+{
+    // Generates the shortest digits of `aUpper` which stay within
+    // `aDelta` of it (within the rounding interval). `aUpper` is split
+    // into its integral part (at most 32 bits) and fractional part.
+
+    const uint64_t one      = 1ull << -aUpper.mExponent;
+    const uint64_t distance = aUpper.mSignificand - aValue.mSignificand;
+    uint32_t       integral = static_cast<uint32_t>(aUpper.mSignificand >> -aUpper.mExponent);
+    uint64_t       fraction = aUpper.mSignificand & (one - 1);
+    int            kappa    = CountDecimalDigits(integral);
+
+    aNumDigits = 0;
+
+    while (kappa > 0)
+    {
+        uint32_t divisor = static_cast<uint32_t>(kPowersOfTen[kappa - 1]);
+        uint32_t digit   = integral / divisor;
+        uint64_t rest;
+
+        integral %= divisor;
+
+        if ((digit != 0) || (aNumDigits != 0))
+        {
+            aDigits[aNumDigits++] = static_cast<char>('0' + digit);
+        }
+
+        kappa--;
+        rest = (static_cast<uint64_t>(integral) << -aUpper.mExponent) + fraction;
+
+        if (rest <= aDelta)
+        {
+            aDecimalExponent += kappa;
+            RoundLastDigit(aDigits, aNumDigits, aDelta, rest, kPowersOfTen[kappa] << -aUpper.mExponent, distance);
+            ExitNow();
+        }
+    }
+
+    while (true)
+    {
+        char digit;
+
+        fraction *= 10;
+        aDelta *= 10;
+        digit = static_cast<char>(fraction >> -aUpper.mExponent);
+
+        if ((digit != 0) || (aNumDigits != 0))
+        {
+            aDigits[aNumDigits++] = static_cast<char>('0' + digit);
+        }
+
+        fraction &= one - 1;
+        kappa--;
+
+        if (fraction < aDelta)
+        {
+            aDecimalExponent += kappa;
+            RoundLastDigit(aDigits, aNumDigits, aDelta, fraction, one,
+                           (-kappa < 20) ? distance * kPowersOfTen[-kappa] : 0);
+            ExitNow();
+        }
+    }
+
+exit:
+    return;
+}
+
+void AppendZeros(StringWriter &aWriter, int aCount)
+{
+    static const char kZeros[] = "0000000000000000";
+
+    while (aCount > 0)
+    {
+        uint16_t count = static_cast<uint16_t>(Min<int>(aCount, sizeof(kZeros) - 1));
+
+        aWriter.Append(StringView(kZeros, count));
+        aCount -= count;
+    }
+}
+
+} // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+// FloatFormatter
+
+FloatFormatter::FloatFormatter(double aValue)
+{
+    uint64_t bits;
+
+    static_assert(sizeof(aValue) == sizeof(bits), "double MUST be IEEE 754 binary64");
+
+    memcpy(&bits, &aValue, sizeof(bits));
+    Init(bits, /* aFractionBits */ 52, /* aExponentBits */ 11);
+}
+
+FloatFormatter::FloatFormatter(float aValue)
+{
+    uint32_t bits;
+
+    static_assert(sizeof(aValue) == sizeof(bits), "float MUST be IEEE 754 binary32");
+
+    memcpy(&bits, &aValue, sizeof(bits));
+    Init(bits, /* aFractionBits */ 23, /* aExponentBits */ 8);
+}
+
+void FloatFormatter::Init(uint64_t aBits, uint8_t aFractionBits, uint8_t aExponentBits)
+{
+    uint64_t hiddenBit      = 1ull << aFractionBits;
+    uint16_t exponentMask   = static_cast<uint16_t>((1u << aExponentBits) - 1);
+    int      bias           = (exponentMask >> 1) + aFractionBits;
+    uint64_t fraction       = aBits & (hiddenBit - 1);
+    uint16_t biasedExponent = static_cast<uint16_t>((aBits >> aFractionBits) & exponentMask);
+
+    mNumDigits       = 0;
+    mDecimalExponent = 0;
+    mIsNegative      = ((aBits >> (aFractionBits + aExponentBits)) & 1) != 0;
+
+    if (biasedExponent == exponentMask)
+    {
+        mType = (fraction == 0) ? kTypeInfinity : kTypeNaN;
+    }
+    else if ((biasedExponent == 0) && (fraction == 0))
+    {
+        mType = kTypeZero;
+    }
+    else
+    {
+        mType = kTypeFinite;
+
+        if (biasedExponent == 0)
+        {
+            // Subnormal value
+            GenerateDigits(fraction, 1 - bias, /* aIsLowerBoundaryCloser */ false);
+        }
+        else
+        {
+            // The lower neighbour is closer than the upper one when
+            // the value is an exact power of two (but not the
+            // smallest normal value).
+            GenerateDigits(fraction | hiddenBit, biasedExponent - bias, (fraction == 0) && (biasedExponent > 1));
+        }
+    }
+}
+
+void FloatFormatter::GenerateDigits(uint64_t aSignificand, int aExponent, bool aIsLowerBoundaryCloser)
+{
+    // The rounding interval of the value is between the midpoints
+    // to its lower and upper neighbours. Any decimal value strictly
+    // within the interval converts back to the same value.
+
+    DiyFp value(aSignificand, aExponent);
+    DiyFp upper((aSignificand << 1) + 1, aExponent - 1);
+    DiyFp lower = aIsLowerBoundaryCloser ? DiyFp((aSignificand << 2) - 1, aExponent - 2)
+                                         : DiyFp((aSignificand << 1) - 1, aExponent - 1);
+    DiyFp cachedPower(0, 0);
+    int   decimalExponent;
+
+    value.Normalize();
+    upper.Normalize();
+    lower.mSignificand <<= lower.mExponent - upper.mExponent;
+    lower.mExponent = upper.mExponent;
+
+    cachedPower = GetCachedPower(upper.mExponent, decimalExponent);
+
+    value = value * cachedPower;
+    upper = upper * cachedPower;
+    lower = lower * cachedPower;
+
+    // Account for the rounding error of the multiplications by
+    // narrowing the interval by one unit on each side.
+
+    upper.mSignificand--;
+    lower.mSignificand++;
+
+    GenerateShortestDigits(value, upper, upper.mSignificand - lower.mSignificand, mDigits, mNumDigits,
+                           decimalExponent);
+
+    mDecimalExponent = static_cast<int16_t>(mNumDigits + decimalExponent);
+}
+
+void FloatFormatter::Round(int aNumDigits)
+{
+    // Rounds the digits (half away from zero) to keep `aNumDigits`
+    // digits. A rounded up carry out of the first digit gives "1"
+    // with the decimal point moved by one.
+
+    uint8_t index;
+
+    VerifyOrExit(aNumDigits < mNumDigits);
+
+    if (aNumDigits < 0)
+    {
+        mNumDigits = 0;
+        ExitNow();
+    }
+
+    index      = static_cast<uint8_t>(aNumDigits);
+    mNumDigits = index;
+
+    VerifyOrExit(mDigits[index] >= '5');
+
+    while ((index > 0) && (mDigits[index - 1] == '9'))
+    {
+        index--;
+    }
+
+    if (index == 0)
+    {
+        mDigits[0] = '1';
+        mNumDigits = 1;
+        mDecimalExponent++;
+    }
+    else
+    {
+        mDigits[index - 1]++;
+        mNumDigits = index;
+    }
+
+exit:
+    return;
+}
+
+bool FloatFormatter::AppendNonFinite(StringWriter &aWriter) const
+{
+    bool isNonFinite = true;
+
+    switch (mType)
+    {
+    case kTypeInfinity:
+        aWriter.Append(mIsNegative ? StringView("-inf", 4) : StringView("inf", 3));
+        break;
+    case kTypeNaN:
+        aWriter.Append(StringView("nan", 3));
+        break;
+    default:
+        isNonFinite = false;
+        break;
+    }
+
+    if (!isNonFinite && mIsNegative)
+    {
+        aWriter.Append(StringView("-", 1));
+    }
+
+    return isNonFinite;
+}
+
+void FloatFormatter::AppendDigits(StringWriter &aWriter, int aStart, int aEnd) const
+{
+    // Appends the digits at positions [`aStart`, `aEnd`). Positions
+    // before the first or after the last digit are appended as zeros.
+
+    int start = Max(aStart, 0);
+    int end   = Min<int>(aEnd, mNumDigits);
+
+    AppendZeros(aWriter, Min(aEnd, 0) - aStart);
+
+    if (start < end)
+    {
+        aWriter.Append(StringView(&mDigits[start], static_cast<uint16_t>(end - start)));
+    }
+
+    AppendZeros(aWriter, aEnd - Max<int>(aStart, mNumDigits));
+}
+
+void FloatFormatter::AppendShortest(StringWriter &aWriter) const
+{
+    int pointPosition = mDecimalExponent;
+
+    VerifyOrExit(!AppendNonFinite(aWriter));
+
+    if (mType == kTypeZero)
+    {
+        aWriter.Append(StringView("0", 1));
+    }
+    else if ((pointPosition >= kMinDecimalExponentForDecimalNotation) &&
+             (pointPosition <= kMaxDecimalExponentForDecimalNotation))
+    {
+        if (pointPosition <= 0)
+        {
+            aWriter.Append(StringView("0.", 2));
+            AppendDigits(aWriter, pointPosition, mNumDigits);
+        }
+        else
+        {
+            AppendDigits(aWriter, 0, pointPosition);
+
+            if (pointPosition < mNumDigits)
+            {
+                aWriter.Append(StringView(".", 1));
+                AppendDigits(aWriter, pointPosition, mNumDigits);
+            }
+        }
+    }
+    else
+    {
+        int exponent = pointPosition - 1;
+
+        AppendDigits(aWriter, 0, 1);
+
+        if (mNumDigits > 1)
+        {
+            aWriter.Append(StringView(".", 1));
+            AppendDigits(aWriter, 1, mNumDigits);
+        }
+
+        aWriter.Append("e%c%d", (exponent < 0) ? '-' : '+', (exponent < 0) ? -exponent : exponent);
+    }
+
+exit:
+    return;
+}
+
+void FloatFormatter::AppendFixed(StringWriter &aWriter, uint8_t aPrecision) const
+{
+    FloatFormatter rounded = *this;
+
+    VerifyOrExit(!AppendNonFinite(aWriter));
+
+    rounded.Round(rounded.mDecimalExponent + aPrecision);
+
+    if (rounded.mDecimalExponent <= 0)
+    {
+        aWriter.Append(StringView("0", 1));
+    }
+    else
+    {
+        rounded.AppendDigits(aWriter, 0, rounded.mDecimalExponent);
+    }
+
+    if (aPrecision > 0)
+    {
+        aWriter.Append(StringView(".", 1));
+        rounded.AppendDigits(aWriter, rounded.mDecimalExponent, rounded.mDecimalExponent + aPrecision);
+    }
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// StringWriter
+
+StringWriter &StringWriter::AppendDouble(double aValue)
+{
+    FloatFormatter(aValue).AppendShortest(*this);
+
+    return *this;
+}
+
+StringWriter &StringWriter::AppendDouble(double aValue, uint8_t aPrecision)
+{
+    FloatFormatter(aValue).AppendFixed(*this, aPrecision);
+
+    return *this;
+}
+
+StringWriter &StringWriter::AppendFloat(float aValue)
+{
+    FloatFormatter(aValue).AppendShortest(*this);
+
+    return *this;
+}
+
+StringWriter &StringWriter::AppendFloat(float aValue, uint8_t aPrecision)
+{
+    FloatFormatter(aValue).AppendFixed(*this, aPrecision);
+
+    return *this;
+}
+
+} // namespace ty
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for formatting floating-point values without libc `printf()`.
+ */
+
+#ifndef FLOAT_FORMAT_HPP_
+#define FLOAT_FORMAT_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "common/string.hpp"
+
+namespace ty {
+
+/**
+ * Converts a floating-point value to its shortest decimal representation and formats it as a string.
+ *
+ * The decimal digits are generated using the Grisu2 algorithm with 64-bit integer arithmetic only. The digits always
+ * convert back (e.g., using `strtod()`) to the exact same value, and are the shortest such digits in all but a tiny
+ * fraction of cases (where one extra digit may be generated).
+ *
+ * Single precision (`float`) values are converted using the precision of `float`, e.g., `0.1f` gives "0.1" (and not
+ * the digits of the `double` value closest to `0.1f`).
+ */
+class FloatFormatter
+{
+public:
+    static constexpr uint8_t kMaxDigits = 17; ///< Maximum number of decimal digits of a value.
+
+    /**
+     * Initializes the `FloatFormatter` from a `double` value.
+     *
+     * @param[in] aValue  The value.
+     */
+    explicit FloatFormatter(double aValue);
+
+    /**
+     * Initializes the `FloatFormatter` from a `float` value.
+     *
+     * @param[in] aValue  The value.
+     */
+    explicit FloatFormatter(float aValue);
+
+    /**
+     * Appends the shortest representation of the value to a given string writer.
+     *
+     * Decimal notation is used if the value is at least 1e-6 and less than 1e21 (in magnitude), e.g., "0.001", "1.5"
+     * or "100", otherwise scientific notation is used, e.g., "1.5e-7" or "2e+21". Zero is appended as "0" (or "-0").
+     * Non-finite values are appended as "inf", "-inf" or "nan".
+     *
+     * @param[in] aWriter  The string writer to append to.
+     */
+    void AppendShortest(StringWriter &aWriter) const;
+
+    /**
+     * Appends the value in decimal notation with a fixed number of fractional digits to a given string writer.
+     *
+     * The shortest representation of the value is rounded (half away from zero) to @p aPrecision fractional digits.
+     * As the decimal digits (and not the exact binary value) are rounded, the result can differ from `printf("%.*f")`
+     * for values whose shortest representation ends exactly at a tie, e.g., 2.675 (stored as 2.67499999...) gives
+     * "2.68" with precision 2, whereas `printf()` gives "2.67". Digits beyond the shortest representation are zero.
+     *
+     * @param[in] aWriter     The string writer to append to.
+     * @param[in] aPrecision  The number of fractional digits. If zero, no decimal point is appended.
+     */
+    void AppendFixed(StringWriter &aWriter, uint8_t aPrecision) const;
+
+private:
+    enum Type : uint8_t
+    {
+        kTypeFinite,
+        kTypeZero,
+        kTypeInfinity,
+        kTypeNaN,
+    };
+
+    static constexpr int16_t kMaxDecimalExponentForDecimalNotation = 21;
+    static constexpr int16_t kMinDecimalExponentForDecimalNotation = -5;
+
+    void Init(uint64_t aBits, uint8_t aFractionBits, uint8_t aExponentBits);
+    void GenerateDigits(uint64_t aSignificand, int aExponent, bool aIsLowerBoundaryCloser);
+    void Round(int aNumDigits);
+    bool AppendNonFinite(StringWriter &aWriter) const;
+    void AppendDigits(StringWriter &aWriter, int aStart, int aEnd) const;
+
+    // The value is `0.<mDigits> * 10^mDecimalExponent`, i.e.,
+    // `mDecimalExponent` is the position of the decimal point
+    // relative to the first digit.
+
+    char    mDigits[kMaxDigits];
+    uint8_t mNumDigits;
+    int16_t mDecimalExponent;
+    bool    mIsNegative;
+    Type    mType;
+};
+
+} // namespace ty
+
+#endif // FLOAT_FORMAT_HPP_
@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the heap.
+ */
+
+#include "heap.hpp"
+
+#include <string.h>
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/num_utils.hpp"
+#include "ty/common/numeric_limits.hpp"
+#include "ty/platform/memory.h"
+
+namespace ty {
+namespace Heap {
+
+struct Counters
+{
+    MemoryCounters mHeap;
+    MemoryCounters mTags[kNumMemoryTags];
+};
+
+static Counters &GetAllCounters(void)
+{
+    // Constructed on first use, so that the heap can be used by the
+    // constructors of other static objects.
+    static Counters sCounters;
+
+    return sCounters;
+}
+
+static uint32_t ClampSize(size_t aSize)
+{
+    return static_cast<uint32_t>(Min<size_t>(aSize, NumericLimits<uint32_t>::kMax));
+}
+
+static void RecordAllocation(MemoryTag aTag, size_t aSize, const void *aPointer, size_t aBytes)
+{
+    Counters &counters = GetAllCounters();
+
+    if (aPointer == nullptr)
+    {
+        counters.mHeap.RecordFailure();
+        counters.mTags[aTag].RecordFailure();
+    }
+    else
+    {
+        counters.mHeap.RecordAllocation(ClampSize(aSize), ClampSize(aBytes));
+        counters.mTags[aTag].RecordAllocation(ClampSize(aSize), ClampSize(aBytes));
+    }
+}
+
+static void RecordFree(MemoryTag aTag, size_t aBytes)
+{
+    Counters &counters = GetAllCounters();
+
+    counters.mHeap.RecordFree(ClampSize(aBytes));
+    counters.mTags[aTag].RecordFree(ClampSize(aBytes));
+}
+
+const MemoryCounters &GetCounters(void) { return GetAllCounters().mHeap; }
+
+const MemoryCounters &GetCounters(MemoryTag aTag) { return GetAllCounters().mTags[aTag]; }
+
+void ResetPeaks(void)
+{
+    Counters &counters = GetAllCounters();
+
+    counters.mHeap.ResetPeak();
+
+    for (MemoryCounters &tagCounters : counters.mTags)
+    {
+        tagCounters.ResetPeak();
+    }
+}
+
+#if TY_CONFIG_HEAP_EXTERNAL_ENABLE
+
+// The size of the allocations is unknown when they are freed, so the
+// number of bytes is not accounted.
+
+void *Allocate(size_t aSize, MemoryTag aTag)
+{
+    void *pointer = tyPlatRealloc(nullptr, aSize);
+
+    RecordAllocation(aTag, aSize, pointer, 0);
+
+    return pointer;
+}
+
+void *CAlloc(size_t aCount, size_t aSize, MemoryTag aTag)
+{
+    void *pointer = tyPlatCAlloc(aCount, aSize);
+
+    RecordAllocation(aTag, aCount * aSize, pointer, 0);
+
+    return pointer;
+}
+
+void *Reallocate(void *aPointer, size_t aSize, MemoryTag aTag)
+{
+    void *pointer = nullptr;
+
+    if (aPointer == nullptr)
+    {
+        ExitNow(pointer = Allocate(aSize, aTag));
+    }
+
+    if (aSize == 0)
+    {
+        Free(aPointer, aTag);
+        ExitNow();
+    }
+
+    pointer = tyPlatRealloc(aPointer, aSize);
+
+    if (pointer != nullptr)
+    {
+        RecordFree(aTag, 0);
+    }
+
+    RecordAllocation(aTag, aSize, pointer, 0);
+
+exit:
+    return pointer;
+}
+
+void Free(void *aPointer, MemoryTag aTag)
+{
+    VerifyOrExit(aPointer != nullptr);
+
+    tyPlatFree(aPointer);
+    RecordFree(aTag, 0);
+
+exit:
+    return;
+}
+
+#else // TY_CONFIG_HEAP_EXTERNAL_ENABLE
+
+#if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT && !TY_CONFIG_MBEDTLS_HEAP_ENABLE
+static constexpr size_t kBaseHeapSize = TY_CONFIG_HEAP_INTERNAL_SIZE;
+#else
+static constexpr size_t kBaseHeapSize = TY_CONFIG_HEAP_INTERNAL_SIZE_NO_DTLS;
+#endif
+
+#if TY_CONFIG_MESSAGE_USE_HEAP_ENABLE
+// The heap also holds the message buffers, up to all of them at the
+// same time.
+static constexpr size_t kMessageHeapSize =
+    Tlsf::GetRegionSizeFor(TY_CONFIG_NUM_MESSAGE_BUFFERS, TY_CONFIG_MESSAGE_BUFFER_SIZE);
+#else
+static constexpr size_t kMessageHeapSize = 0;
+#endif
+
+static constexpr size_t kHeapSize = kBaseHeapSize + kMessageHeapSize + TY_CONFIG_ARENA_OVERFLOW_HEAP_SIZE;
+
+static Tlsf &GetTlsf(void)
+{
+    static StaticTlsf<kHeapSize> sTlsf;
+
+    return sTlsf;
+}
+
+// The allocated sizes are read while holding the lock, as the block
+// headers are updated when their neighbors are freed.
+
+static size_t GetAllocatedSize(const void *aPointer)
+{
+    return (aPointer != nullptr) ? Tlsf::GetAllocatedSize(aPointer) : 0;
+}
+
+void *Allocate(size_t aSize, MemoryTag aTag)
+{
+    void  *pointer;
+    size_t bytes;
+
+    {
+        Lock lock;
+
+        pointer = GetTlsf().Allocate(aSize);
+        bytes   = GetAllocatedSize(pointer);
+    }
+
+    RecordAllocation(aTag, aSize, pointer, bytes);
+
+    return pointer;
+}
+
+void *CAlloc(size_t aCount, size_t aSize, MemoryTag aTag)
+{
+    void  *pointer = nullptr;
+    size_t bytes   = 0;
+
+    if ((aSize == 0) || (aCount <= NumericLimits<size_t>::kMax / aSize))
+    {
+        Lock lock;
+
+        pointer = GetTlsf().Allocate(aCount * aSize);
+        bytes   = GetAllocatedSize(pointer);
+    }
+
+    RecordAllocation(aTag, aCount * aSize, pointer, bytes);
+
+    // The memory is zeroed after releasing the lock, which may be a
+    // critical section (see `tyPlatHeapLock()`).
+
+    if (pointer != nullptr)
+    {
+        memset(pointer, 0, aCount * aSize);
+    }
+
+    return pointer;
+}
+
+void *Reallocate(void *aPointer, size_t aSize, MemoryTag aTag)
+{
+    void  *pointer = nullptr;
+    size_t oldBytes;
+    size_t bytes;
+
+    if (aPointer == nullptr)
+    {
+        ExitNow(pointer = Allocate(aSize, aTag));
+    }
+
+    if (aSize == 0)
+    {
+        Free(aPointer, aTag);
+        ExitNow();
+    }
+
+    {
+        Lock lock;
+
+        oldBytes = GetAllocatedSize(aPointer);
+        pointer  = GetTlsf().Reallocate(aPointer, aSize);
+        bytes    = GetAllocatedSize(pointer);
+    }
+
+    if (pointer != nullptr)
+    {
+        RecordFree(aTag, oldBytes);
+    }
+
+    RecordAllocation(aTag, aSize, pointer, bytes);
+
+exit:
+    return pointer;
+}
+
+void Free(void *aPointer, MemoryTag aTag)
+{
+    size_t bytes;
+
+    VerifyOrExit(aPointer != nullptr);
+
+    {
+        Lock lock;
+
+        bytes = GetAllocatedSize(aPointer);
+        GetTlsf().Free(aPointer);
+    }
+
+    RecordFree(aTag, bytes);
+
+exit:
+    return;
+}
+
+void GetStats(Tlsf::Stats &aStats)
+{
+    Lock lock;
+
+    GetTlsf().GetStats(aStats);
+}
+
+#endif // TY_CONFIG_HEAP_EXTERNAL_ENABLE
+
+} // namespace Heap
+} // namespace ty
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for the heap.
+ */
+
+#ifndef HEAP_HPP_
+#define HEAP_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stddef.h>
+
+#include "common/memory_stats.hpp"
+#include "ty/common/non_copyable.hpp"
+#include "ty/platform/memory.h"
+
+#if !TY_CONFIG_HEAP_EXTERNAL_ENABLE
+#include "common/tlsf.hpp"
+#endif
+
+namespace ty {
+namespace Heap {
+
+/**
+ * Holds the heap lock while in scope, if `TY_CONFIG_HEAP_THREAD_SAFE_ENABLE` is set (see `tyPlatHeapLock()`).
+ *
+ * The lock is not recursive, so the heap MUST NOT be used while holding it.
+ */
+class Lock : private NonCopyable
+{
+public:
+    /**
+     * Acquires the heap lock.
+     */
+    Lock(void)
+    {
+#if TY_CONFIG_HEAP_THREAD_SAFE_ENABLE
+        tyPlatHeapLock();
+#endif
+    }
+
+    /**
+     * Releases the heap lock.
+     */
+    ~Lock(void)
+    {
+#if TY_CONFIG_HEAP_THREAD_SAFE_ENABLE
+        tyPlatHeapUnlock();
+#endif
+    }
+};
+
+/**
+ * Allocates memory from the heap.
+ *
+ * The heap is the internal TLSF heap (see `Tlsf`), or the platform allocator if `TY_CONFIG_HEAP_EXTERNAL_ENABLE` is
+ * set. The internal heap is thread-safe if `TY_CONFIG_HEAP_THREAD_SAFE_ENABLE` is set.
+ *
+ * The allocation is accounted in the heap statistics and in those of a given tag (see `GetCounters()`). The memory
+ * MUST be freed or reallocated with the same tag.
+ *
+ * @param[in] aSize  The size to allocate (in bytes).
+ * @param[in] aTag   The tag of the module allocating the memory.
+ *
+ * @returns A pointer to the allocated memory, or `nullptr` if it could not be allocated.
+ */
+void *Allocate(size_t aSize, MemoryTag aTag = kMemoryTagOther);
+
+/**
+ * Allocates memory from the heap for an array of objects, with all bytes set to zero.
+ *
+ * @param[in] aCount  The number of objects.
+ * @param[in] aSize   The size of each object (in bytes).
+ * @param[in] aTag    The tag of the module allocating the memory.
+ *
+ * @returns A pointer to the allocated memory, or `nullptr` if it could not be allocated.
+ */
+void *CAlloc(size_t aCount, size_t aSize, MemoryTag aTag = kMemoryTagOther);
+
+/**
+ * Changes the size of memory allocated from the heap, keeping its content.
+ *
+ * A successful reallocation is accounted as a free followed by an allocation.
+ *
+ * @param[in] aPointer  A pointer to the allocated memory, or `nullptr` (to allocate new memory).
+ * @param[in] aSize     The new size (in bytes).
+ * @param[in] aTag      The tag of the module which allocated the memory.
+ *
+ * @returns A pointer to the reallocated memory, or `nullptr` if it could not be reallocated (@p aPointer is then
+ *          unchanged).
+ */
+void *Reallocate(void *aPointer, size_t aSize, MemoryTag aTag = kMemoryTagOther);
+
+/**
+ * Frees memory allocated from the heap.
+ *
+ * @param[in] aPointer  A pointer to the allocated memory, or `nullptr` (ignored).
+ * @param[in] aTag      The tag of the module which allocated the memory.
+ */
+void Free(void *aPointer, MemoryTag aTag = kMemoryTagOther);
+
+/**
+ * Returns the usage counters of the heap.
+ *
+ * @returns The usage counters of the heap.
+ */
+const MemoryCounters &GetCounters(void);
+
+/**
+ * Returns the usage counters of the heap allocations with a given tag.
+ *
+ * @param[in] aTag  The tag (MUST be valid).
+ *
+ * @returns The usage counters of the allocations with @p aTag.
+ */
+const MemoryCounters &GetCounters(MemoryTag aTag);
+
+/**
+ * Resets the high-water marks of the heap and tag usage counters.
+ */
+void ResetPeaks(void);
+
+#if !TY_CONFIG_HEAP_EXTERNAL_ENABLE
+/**
+ * Gets the statistics of the internal heap (see `Tlsf::GetStats()`).
+ *
+ * @param[out] aStats  A reference to output the statistics.
+ */
+void GetStats(Tlsf::Stats &aStats);
+#endif
+
+} // namespace Heap
+} // namespace ty
+
+#endif // HEAP_HPP_
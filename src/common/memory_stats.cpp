@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the memory usage statistics.
+ */
+
+#include "memory_stats.hpp"
+
+#include "common/heap.hpp"
+#include "common/message_pool.hpp"
+#include "crypto/mbedtls.hpp"
+#include "instance/instance.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/num_utils.hpp"
+
+/********************************************
+ * C API
+ *******************************************/
+tinyError tinyMemoryGetAllocatorStats(tinyInstance *aInstance, tinyMemoryAllocator aAllocator, tinyMemoryStats *aStats)
+{
+    return ty::AsCoreType(aInstance).Get<ty::MemoryAccounting>().GetAllocatorStats(ty::MapEnum(aAllocator),
+                                                                                     ty::AsCoreType(aStats));
+}
+
+tinyError tinyMemoryGetTagStats(tinyInstance *aInstance, tinyMemoryTag aTag, tinyMemoryStats *aStats)
+{
+    return ty::AsCoreType(aInstance).Get<ty::MemoryAccounting>().GetTagStats(ty::MapEnum(aTag), ty::AsCoreType(aStats));
+}
+
+void tinyMemoryResetPeaks(tinyInstance *aInstance)
+{
+    ty::AsCoreType(aInstance).Get<ty::MemoryAccounting>().ResetPeaks();
+}
+
+/********************************************
+ * C++ Implementation
+ *******************************************/
+namespace ty {
+
+uint8_t MemoryStats::GetHistogramBucket(uint32_t aSize)
+{
+    // Bucket `i` holds the sizes in `(8 << i, 16 << i]`, the first one
+    // also holds the smaller sizes and the last one the larger sizes.
+
+    uint8_t bucket = 0;
+
+    if (aSize > 16)
+    {
+        bucket = static_cast<uint8_t>(32 - CountLeadingZeros(aSize - 1) - 4);
+    }
+
+    return Min<uint8_t>(bucket, kHistogramSize - 1);
+}
+
+MemoryCounters::MemoryCounters(void)
+    : mCurrentBytes(0)
+    , mPeakBytes(0)
+    , mNumAllocations(0)
+    , mNumFrees(0)
+    , mNumFailures(0)
+{
+    for (Atomic<uint32_t> &count : mSizeHistogram)
+    {
+        count.Store(0, kMemoryOrderRelaxed);
+    }
+}
+
+void MemoryCounters::RecordAllocation(uint32_t aSize, uint32_t aBytes, uint32_t aCount)
+{
+    mNumAllocations.FetchAdd(aCount, kMemoryOrderRelaxed);
+    mSizeHistogram[MemoryStats::GetHistogramBucket(aSize)].FetchAdd(aCount, kMemoryOrderRelaxed);
+
+    if (aBytes != 0)
+    {
+        uint32_t current = mCurrentBytes.FetchAdd(aBytes * aCount, kMemoryOrderRelaxed) + aBytes * aCount;
+        uint32_t peak    = mPeakBytes.Load(kMemoryOrderRelaxed);
+
+        while (current > peak)
+        {
+            if (mPeakBytes.CompareExchangeWeak(peak, current, kMemoryOrderRelaxed, kMemoryOrderRelaxed))
+            {
+                break;
+            }
+        }
+    }
+}
+
+void MemoryCounters::RecordFree(uint32_t aBytes, uint32_t aCount)
+{
+    mNumFrees.FetchAdd(aCount, kMemoryOrderRelaxed);
+
+    if (aBytes != 0)
+    {
+        mCurrentBytes.FetchSub(aBytes * aCount, kMemoryOrderRelaxed);
+    }
+}
+
+void MemoryCounters::GetStats(MemoryStats &aStats) const
+{
+    aStats.mCapacityBytes  = 0;
+    aStats.mCurrentBytes   = mCurrentBytes.Load(kMemoryOrderRelaxed);
+    aStats.mPeakBytes      = mPeakBytes.Load(kMemoryOrderRelaxed);
+    aStats.mNumAllocations = mNumAllocations.Load(kMemoryOrderRelaxed);
+    aStats.mNumFrees       = mNumFrees.Load(kMemoryOrderRelaxed);
+    aStats.mNumFailures    = mNumFailures.Load(kMemoryOrderRelaxed);
+
+    for (uint8_t bucket = 0; bucket < MemoryStats::kHistogramSize; bucket++)
+    {
+        aStats.mSizeHistogram[bucket] = mSizeHistogram[bucket].Load(kMemoryOrderRelaxed);
+    }
+}
+
+Error MemoryAccounting::GetAllocatorStats(MemoryAllocator aAllocator, MemoryStats &aStats) const
+{
+    Error error = kErrorNone;
+
+    switch (aAllocator)
+    {
+    case kMemoryAllocatorHeap:
+        Heap::GetCounters().GetStats(aStats);
+#if !TY_CONFIG_HEAP_EXTERNAL_ENABLE
+        {
+            Tlsf::Stats heapStats;
+
+            Heap::GetStats(heapStats);
+            aStats.mCapacityBytes = static_cast<uint32_t>(heapStats.mTotalSize);
+        }
+#endif
+        break;
+
+    case kMemoryAllocatorMessagePool:
+        mMessagePool.GetStats(aStats);
+        break;
+
+    case kMemoryAllocatorMbedTls:
+#if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+        MbedTls::GetStats(aStats);
+#else
+        error = kErrorNotFound;
+#endif
+        break;
+
+    default:
+        error = kErrorInvalidArgs;
+        break;
+    }
+
+    return error;
+}
+
+Error MemoryAccounting::GetTagStats(MemoryTag aTag, MemoryStats &aStats) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aTag < kNumMemoryTags, error = kErrorInvalidArgs);
+    Heap::GetCounters(aTag).GetStats(aStats);
+
+exit:
+    return error;
+}
+
+void MemoryAccounting::ResetPeaks(void)
+{
+    Heap::ResetPeaks();
+    mMessagePool.ResetMaxUsedBufferCount();
+#if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+    MbedTls::ResetPeaks();
+#endif
+}
+
+} // namespace ty
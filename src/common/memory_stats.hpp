@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for the memory usage statistics.
+ */
+
+#ifndef MEMORY_STATS_HPP_
+#define MEMORY_STATS_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ty/memory.h"
+#include "ty/common/as_core_type.hpp"
+#include "ty/common/atomic.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/non_copyable.hpp"
+
+namespace ty {
+
+class MessagePool;
+
+/**
+ * Represents an allocator.
+ */
+enum MemoryAllocator : uint8_t
+{
+    kMemoryAllocatorHeap        = TY_MEMORY_ALLOCATOR_HEAP,         ///< The heap.
+    kMemoryAllocatorMessagePool = TY_MEMORY_ALLOCATOR_MESSAGE_POOL, ///< The message buffer pool.
+    kMemoryAllocatorMbedTls     = TY_MEMORY_ALLOCATOR_MBEDTLS,      ///< The mbedTLS heap.
+    kNumMemoryAllocators        = TY_NUM_MEMORY_ALLOCATORS,         ///< The number of allocators.
+};
+
+/**
+ * Represents the module which allocates memory from the heap.
+ */
+enum MemoryTag : uint8_t
+{
+    kMemoryTagOther   = TY_MEMORY_TAG_OTHER,   ///< Other modules.
+    kMemoryTagMessage = TY_MEMORY_TAG_MESSAGE, ///< Message buffers.
+    kMemoryTagArena   = TY_MEMORY_TAG_ARENA,   ///< Arena overflow blocks.
+    kMemoryTagMbedTls = TY_MEMORY_TAG_MBEDTLS, ///< mbedTLS (without a dedicated heap region).
+    kNumMemoryTags    = TY_NUM_MEMORY_TAGS,    ///< The number of tags.
+};
+
+/**
+ * Represents the memory usage statistics of an allocator or of a tag.
+ */
+class MemoryStats : public tinyMemoryStats
+{
+public:
+    static constexpr uint8_t kHistogramSize = TY_MEMORY_HISTOGRAM_SIZE; ///< Number of buckets in the histogram.
+
+    /**
+     * Clears the statistics.
+     */
+    void Clear(void) { memset(this, 0, sizeof(*this)); }
+
+    /**
+     * Returns the bucket of the size histogram which counts the allocations of a given size.
+     *
+     * @param[in] aSize  The size of the allocation (in bytes).
+     *
+     * @returns The histogram bucket.
+     */
+    static uint8_t GetHistogramBucket(uint32_t aSize);
+};
+
+/**
+ * Counts the memory usage of an allocator or of a tag.
+ *
+ * The counters are updated with relaxed atomic operations, so they can be updated from multiple threads without a
+ * lock, and the statistics read from them are only consistent when there is no concurrent update.
+ */
+class MemoryCounters : private NonCopyable
+{
+public:
+    /**
+     * Initializes the counters to zero.
+     */
+    MemoryCounters(void);
+
+    /**
+     * Records successful allocations.
+     *
+     * @param[in] aSize   The requested size of each allocation (in bytes), for the histogram.
+     * @param[in] aBytes  The number of bytes allocated by each allocation, or zero if unknown.
+     * @param[in] aCount  The number of allocations.
+     */
+    void RecordAllocation(uint32_t aSize, uint32_t aBytes, uint32_t aCount = 1);
+
+    /**
+     * Records frees.
+     *
+     * @param[in] aBytes  The number of bytes freed by each free, or zero if unknown.
+     * @param[in] aCount  The number of frees.
+     */
+    void RecordFree(uint32_t aBytes, uint32_t aCount = 1);
+
+    /**
+     * Records a failed allocation.
+     */
+    void RecordFailure(void) { mNumFailures.FetchAdd(1, kMemoryOrderRelaxed); }
+
+    /**
+     * Gets the statistics (`mCapacityBytes` is set to zero).
+     *
+     * @param[out] aStats  A reference to output the statistics.
+     */
+    void GetStats(MemoryStats &aStats) const;
+
+    /**
+     * Returns the number of bytes currently allocated.
+     *
+     * @returns The number of bytes currently allocated.
+     */
+    uint32_t GetCurrentBytes(void) const { return mCurrentBytes.Load(kMemoryOrderRelaxed); }
+
+    /**
+     * Resets the high-water mark to the current number of bytes.
+     */
+    void ResetPeak(void) { mPeakBytes.Store(mCurrentBytes.Load(kMemoryOrderRelaxed), kMemoryOrderRelaxed); }
+
+private:
+    Atomic<uint32_t> mCurrentBytes;
+    Atomic<uint32_t> mPeakBytes;
+    Atomic<uint32_t> mNumAllocations;
+    Atomic<uint32_t> mNumFrees;
+    Atomic<uint32_t> mNumFailures;
+    Atomic<uint32_t> mSizeHistogram[MemoryStats::kHistogramSize];
+};
+
+/**
+ * Provides the memory usage statistics of the allocators used by an instance.
+ */
+class MemoryAccounting : private NonCopyable
+{
+public:
+    /**
+     * Initializes the memory accounting.
+     *
+     * @param[in] aMessagePool  The message buffer pool of the instance.
+     */
+    explicit MemoryAccounting(MessagePool &aMessagePool)
+        : mMessagePool(aMessagePool)
+    {
+    }
+
+    /**
+     * Gets the memory usage statistics of an allocator.
+     *
+     * @param[in]  aAllocator  The allocator.
+     * @param[out] aStats      A reference to output the statistics.
+     *
+     * @retval kErrorNone         Successfully got the statistics.
+     * @retval kErrorNotFound     @p aAllocator is not used (mbedTLS is not managed).
+     * @retval kErrorInvalidArgs  @p aAllocator is not valid.
+     */
+    Error GetAllocatorStats(MemoryAllocator aAllocator, MemoryStats &aStats) const;
+
+    /**
+     * Gets the heap usage statistics of the allocations with a given tag.
+     *
+     * @param[in]  aTag    The tag.
+     * @param[out] aStats  A reference to output the statistics.
+     *
+     * @retval kErrorNone         Successfully got the statistics.
+     * @retval kErrorInvalidArgs  @p aTag is not valid.
+     */
+    Error GetTagStats(MemoryTag aTag, MemoryStats &aStats) const;
+
+    /**
+     * Resets the high-water marks of all the allocators and tags.
+     */
+    void ResetPeaks(void);
+
+private:
+    MessagePool &mMessagePool;
+};
+
+DefineCoreType(tinyMemoryStats, MemoryStats);
+DefineMapEnum(tinyMemoryAllocator, MemoryAllocator);
+DefineMapEnum(tinyMemoryTag, MemoryTag);
+
+} // namespace ty
+
+#endif // MEMORY_STATS_HPP_
@@ -0,0 +1,482 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements messages made of chained message buffers.
+ */
+
+#include "message.hpp"
+
+#include <string.h>
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/debug.hpp"
+#include "ty/common/new.hpp"
+#include "ty/common/num_utils.hpp"
+
+namespace ty {
+
+Message::Message(MessagePool &aPool)
+    : mPool(aPool)
+    , mHead(nullptr)
+    , mTail(nullptr)
+    , mLength(0)
+{
+}
+
+Message::Message(Message &&aOther)
+    : mPool(aOther.mPool)
+    , mHead(aOther.mHead)
+    , mTail(aOther.mTail)
+    , mLength(aOther.mLength)
+{
+    aOther.mHead   = nullptr;
+    aOther.mTail   = nullptr;
+    aOther.mLength = 0;
+}
+
+Message &Message::operator=(Message &&aOther)
+{
+    if (this != &aOther)
+    {
+        Free();
+
+        mHead   = aOther.mHead;
+        mTail   = aOther.mTail;
+        mLength = aOther.mLength;
+
+        aOther.mHead   = nullptr;
+        aOther.mTail   = nullptr;
+        aOther.mLength = 0;
+    }
+
+    return *this;
+}
+
+void Message::Free(void)
+{
+    while (mHead != nullptr)
+    {
+        Segment *next = mHead->mNext;
+
+        ReleaseSegment(mHead);
+        mHead = next;
+    }
+
+    mTail   = nullptr;
+    mLength = 0;
+}
+
+Error Message::ReserveHeadroom(uint16_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((mHead == nullptr) && (aLength <= kDataSize), error = kErrorInvalidArgs);
+
+    mHead = NewSegment(aLength);
+    VerifyOrExit(mHead != nullptr, error = kErrorNoBufs);
+    mTail = mHead;
+
+exit:
+    return error;
+}
+
+Error Message::Append(const void *aBuf, uint16_t aLength)
+{
+    Error          error      = kErrorNone;
+    const uint8_t *bytes      = static_cast<const uint8_t *>(aBuf);
+    uint16_t       oldLength  = mLength;
+    bool           hadSegment = (mHead != nullptr);
+
+    VerifyOrExit(aLength <= kMaxLength - mLength, error = kErrorNoBufs);
+
+    while (aLength > 0)
+    {
+        uint16_t length;
+
+        if ((mTail == nullptr) || !IsWritable(*mTail) || (mTail->GetTailRoom() == 0))
+        {
+            Segment *segment = NewSegment(0);
+
+            VerifyOrExit(segment != nullptr, error = kErrorNoBufs);
+            LinkTail(segment);
+        }
+
+        length = Min(aLength, mTail->GetTailRoom());
+        memcpy(mTail->mData + mTail->mLength, bytes, length);
+        mTail->mLength += length;
+        mLength += length;
+        bytes += length;
+        aLength -= length;
+    }
+
+exit:
+    if (error != kErrorNone)
+    {
+        RollBack(hadSegment, oldLength);
+    }
+
+    return error;
+}
+
+Error Message::Prepend(const void *aBuf, uint16_t aLength)
+{
+    Error          error      = kErrorNone;
+    const uint8_t *bytes      = static_cast<const uint8_t *>(aBuf);
+    uint16_t       oldLength  = mLength;
+    bool           hadSegment = (mHead != nullptr);
+
+    VerifyOrExit(aLength <= kMaxLength - mLength, error = kErrorNoBufs);
+
+    // The bytes are copied from the last one, so that each new segment
+    // is filled from its end.
+
+    while (aLength > 0)
+    {
+        uint16_t length;
+
+        if ((mHead == nullptr) || !IsWritable(*mHead) || (mHead->GetHeadRoom() == 0))
+        {
+            Segment *segment = NewSegment(kDataSize);
+
+            VerifyOrExit(segment != nullptr, error = kErrorNoBufs);
+
+            segment->mNext = mHead;
+            mHead          = segment;
+
+            if (mTail == nullptr)
+            {
+                mTail = segment;
+            }
+        }
+
+        length = Min(aLength, mHead->GetHeadRoom());
+        aLength -= length;
+        mHead->mData -= length;
+        mHead->mLength += length;
+        mLength += length;
+        memcpy(mHead->mData, bytes + aLength, length);
+    }
+
+exit:
+    if (error != kErrorNone)
+    {
+        if (hadSegment)
+        {
+            SuccessOrAssert(RemoveHeader(static_cast<uint16_t>(mLength - oldLength)));
+        }
+        else
+        {
+            Free();
+        }
+    }
+
+    return error;
+}
+
+Error Message::RemoveHeader(uint16_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aLength <= mLength, error = kErrorInvalidArgs);
+
+    mLength -= aLength;
+
+    while (aLength > 0)
+    {
+        uint16_t length = Min(aLength, mHead->mLength);
+
+        mHead->mData += length;
+        mHead->mLength -= length;
+        aLength -= length;
+
+        // An emptied first segment is kept (for its space to be used
+        // by `Prepend()`) unless more bytes are to be removed after it
+        // or its space cannot be written.
+
+        if ((mHead->mLength == 0) && ((aLength > 0) || !IsWritable(*mHead)))
+        {
+            Segment *next = mHead->mNext;
+
+            ReleaseSegment(mHead);
+            mHead = next;
+
+            if (mHead == nullptr)
+            {
+                mTail = nullptr;
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Message::RemoveFooter(uint16_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aLength <= mLength, error = kErrorInvalidArgs);
+    Truncate(static_cast<uint16_t>(mLength - aLength));
+
+exit:
+    return error;
+}
+
+uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const
+{
+    uint8_t *bytes   = static_cast<uint8_t *>(aBuf);
+    uint16_t numRead = 0;
+
+    for (const Segment *segment = mHead; (segment != nullptr) && (numRead < aLength); segment = segment->mNext)
+    {
+        uint16_t length;
+
+        if (aOffset >= segment->mLength)
+        {
+            aOffset -= segment->mLength;
+            continue;
+        }
+
+        length = Min(static_cast<uint16_t>(segment->mLength - aOffset), static_cast<uint16_t>(aLength - numRead));
+        memcpy(bytes + numRead, segment->mData + aOffset, length);
+        numRead += length;
+        aOffset = 0;
+    }
+
+    return numRead;
+}
+
+Error Message::AppendSlice(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    Error          error      = kErrorNone;
+    uint16_t       oldLength  = mLength;
+    bool           hadSegment = (mHead != nullptr);
+    const Segment *segment;
+
+    VerifyOrExit(&aMessage.mPool == &mPool, error = kErrorInvalidArgs);
+    VerifyOrExit((aOffset <= aMessage.mLength) && (aLength <= aMessage.mLength - aOffset), error = kErrorInvalidArgs);
+    VerifyOrExit(aLength <= kMaxLength - mLength, error = kErrorNoBufs);
+
+    // When appending a part of the message itself, the new segments
+    // are linked after the part, so they are never visited.
+
+    for (segment = aMessage.mHead; aLength > 0; segment = segment->mNext)
+    {
+        Segment *sharing;
+        uint16_t length;
+
+        if (aOffset >= segment->mLength)
+        {
+            aOffset -= segment->mLength;
+            continue;
+        }
+
+        length = Min(static_cast<uint16_t>(segment->mLength - aOffset), aLength);
+
+        sharing = NewSegment(0);
+        VerifyOrExit(sharing != nullptr, error = kErrorNoBufs);
+
+        sharing->mStorage = segment->mStorage;
+        sharing->mStorage->mRefCount.FetchAdd(1, kMemoryOrderRelaxed);
+        sharing->mData   = segment->mData + aOffset;
+        sharing->mLength = length;
+
+        LinkTail(sharing);
+        mLength += length;
+        aLength -= length;
+        aOffset = 0;
+    }
+
+exit:
+    if (error != kErrorNone)
+    {
+        RollBack(hadSegment, oldLength);
+    }
+
+    return error;
+}
+
+Error Message::Slice(uint16_t aOffset, uint16_t aLength, Message &aSlice) const
+{
+    Error error;
+
+    aSlice.Free();
+    error = aSlice.AppendSlice(*this, aOffset, aLength);
+
+    if (error != kErrorNone)
+    {
+        aSlice.Free();
+    }
+
+    return error;
+}
+
+Error Message::GetFirstChunk(Chunk &aChunk) const
+{
+    aChunk.mSegment = nullptr;
+
+    return GetNextChunk(aChunk);
+}
+
+Error Message::GetNextChunk(Chunk &aChunk) const
+{
+    Error          error   = kErrorNone;
+    const Segment *segment = (aChunk.mSegment == nullptr) ? mHead : aChunk.mSegment->mNext;
+
+    // Only the first segment can be empty.
+    if ((segment != nullptr) && (segment->mLength == 0))
+    {
+        segment = segment->mNext;
+    }
+
+    VerifyOrExit(segment != nullptr, error = kErrorNotFound);
+
+    aChunk.mBytes   = segment->mData;
+    aChunk.mLength  = segment->mLength;
+    aChunk.mSegment = segment;
+
+exit:
+    return error;
+}
+
+#if TY_CONFIG_MESSAGE_IOVEC_ENABLE
+Error Message::GetIoVecs(struct iovec *aIoVecs, uint16_t &aNumIoVecs) const
+{
+    Error    error     = kErrorNone;
+    uint16_t numIoVecs = 0;
+    Chunk    chunk;
+
+    for (Error chunkError = GetFirstChunk(chunk); chunkError == kErrorNone; chunkError = GetNextChunk(chunk))
+    {
+        if (numIoVecs < aNumIoVecs)
+        {
+            aIoVecs[numIoVecs].iov_base = const_cast<uint8_t *>(chunk.GetBytes());
+            aIoVecs[numIoVecs].iov_len  = chunk.GetLength();
+        }
+        else
+        {
+            error = kErrorNoBufs;
+        }
+
+        numIoVecs++;
+    }
+
+    aNumIoVecs = numIoVecs;
+
+    return error;
+}
+#endif
+
+Message::Segment *Message::NewSegment(uint16_t aHeadRoom)
+{
+    MessagePool::Buffer *buffer  = mPool.NewBuffer();
+    Segment             *segment = nullptr;
+
+    VerifyOrExit(buffer != nullptr);
+
+    segment = new (buffer->GetBytes()) Segment();
+
+    segment->mNext    = nullptr;
+    segment->mStorage = segment;
+    segment->mData    = segment->GetStart() + aHeadRoom;
+    segment->mLength  = 0;
+    segment->mRefCount.Store(1, kMemoryOrderRelaxed);
+
+exit:
+    return segment;
+}
+
+void Message::ReleaseSegment(Segment *aSegment)
+{
+    // The last reference may be released by another thread, so the
+    // release and acquire orders ensure all the uses of the buffer
+    // (by any thread) happen before it is freed.
+
+    if (aSegment->mRefCount.FetchSub(1, kMemoryOrderAcqRel) == 1)
+    {
+        Segment *storage = aSegment->mStorage;
+
+        // The segment is at the start of its buffer.
+        mPool.FreeBuffer(reinterpret_cast<MessagePool::Buffer *>(aSegment));
+
+        if (storage != aSegment)
+        {
+            ReleaseSegment(storage);
+        }
+    }
+}
+
+bool Message::IsWritable(const Segment &aSegment) const
+{
+    return (aSegment.mStorage == &aSegment) && (aSegment.mRefCount.Load(kMemoryOrderAcquire) == 1);
+}
+
+void Message::LinkTail(Segment *aSegment)
+{
+    if (mTail == nullptr)
+    {
+        mHead = aSegment;
+    }
+    else
+    {
+        mTail->mNext = aSegment;
+    }
+
+    mTail = aSegment;
+}
+
+void Message::RollBack(bool aHadSegment, uint16_t aLength)
+{
+    // Restores the message after an append failed. The first segment
+    // is kept by `Truncate(0)`, so a message which had no segment is
+    // freed instead.
+
+    if (aHadSegment)
+    {
+        Truncate(aLength);
+    }
+    else
+    {
+        Free();
+    }
+}
+
+void Message::Truncate(uint16_t aLength)
+{
+    // Keeps the segments up to the one containing the new end (or the
+    // first segment if the new length is zero, even if it was added
+    // after the message became empty) and releases the rest.
+
+    Segment *segment = mHead;
+    uint16_t offset  = 0;
+    Segment *next;
+
+    VerifyOrExit(segment != nullptr);
+
+    while (offset + segment->mLength < aLength)
+    {
+        offset += segment->mLength;
+        segment = segment->mNext;
+    }
+
+    segment->mLength = static_cast<uint16_t>(aLength - offset);
+    mLength          = aLength;
+    mTail            = segment;
+
+    next           = segment->mNext;
+    segment->mNext = nullptr;
+
+    while (next != nullptr)
+    {
+        segment = next->mNext;
+        ReleaseSegment(next);
+        next = segment;
+    }
+
+exit:
+    return;
+}
+
+} // namespace ty
@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for messages made of chained message buffers.
+ */
+
+#ifndef MESSAGE_HPP_
+#define MESSAGE_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#if TY_CONFIG_MESSAGE_IOVEC_ENABLE
+#include <sys/uio.h>
+#endif
+
+#include "common/message_pool.hpp"
+#include "ty/common/atomic.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/non_copyable.hpp"
+
+namespace ty {
+
+/**
+ * Represents a message (a sequence of bytes, e.g., a packet) stored in a chain of buffers from a `MessagePool`.
+ *
+ * Each buffer in the chain (a segment) holds a contiguous part of the message. Headers can be prepended and stripped,
+ * and payload appended and trimmed, without moving the rest of the message. Space can be reserved at the start of the
+ * message (headroom) so that the headers prepended later by lower layers are written in front of the payload in the
+ * same buffer.
+ *
+ * Parts of a message can be shared with other messages without copying (see `Slice()` and `AppendSlice()`). A shared
+ * part is referenced by a segment of the other message, and its buffer is reference-counted: it is freed when the
+ * last message referencing it releases it. The bytes of a shared buffer are never modified, new bytes are always
+ * written to an unshared buffer. A shared buffer can be released by a different thread than the one which allocated
+ * it, but a given `Message` object MUST only be used by one thread at a time.
+ *
+ * The content of a message can be read as a sequence of contiguous chunks (see `GetFirstChunk()`), e.g., to pass it to
+ * a scatter/gather I/O function without first copying it to a flat buffer.
+ */
+class Message : private NonCopyable
+{
+    struct Segment;
+
+public:
+    static constexpr uint16_t kMaxLength = 0xffff; ///< Maximum length of a message (in bytes).
+
+    /**
+     * Represents a contiguous chunk of the bytes of a message.
+     */
+    class Chunk
+    {
+        friend class Message;
+
+    public:
+        /**
+         * Returns a pointer to the bytes of the chunk.
+         *
+         * @returns A pointer to the bytes of the chunk.
+         */
+        const uint8_t *GetBytes(void) const { return mBytes; }
+
+        /**
+         * Returns the length of the chunk (number of bytes).
+         *
+         * @returns The length of the chunk.
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+    private:
+        const uint8_t *mBytes;
+        uint16_t       mLength;
+        const Segment *mSegment;
+    };
+
+    /**
+     * Initializes an empty message which allocates its buffers from a given pool.
+     *
+     * @param[in] aPool  The message buffer pool.
+     */
+    explicit Message(MessagePool &aPool);
+
+    /**
+     * Initializes a message by taking over the content of another message (which is left empty).
+     *
+     * @param[in] aOther  The message to move from.
+     */
+    Message(Message &&aOther);
+
+    /**
+     * Frees the message (see `Free()`).
+     */
+    ~Message(void) { Free(); }
+
+    /**
+     * Frees the content of the message and takes over the content of another message (which is left empty).
+     *
+     * Both messages MUST use the same pool.
+     *
+     * @param[in] aOther  The message to move from.
+     *
+     * @returns A reference to this message.
+     */
+    Message &operator=(Message &&aOther);
+
+    /**
+     * Frees the content of the message (releasing its buffers), leaving the message empty.
+     */
+    void Free(void);
+
+    /**
+     * Returns the length of the message (number of bytes).
+     *
+     * @returns The length of the message.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * Reserves space at the start of an empty message, to be used by later calls to `Prepend()`.
+     *
+     * @param[in] aLength  The length of the space to reserve (in bytes).
+     *
+     * @retval kErrorNone         Successfully reserved the space.
+     * @retval kErrorInvalidArgs  The message is not empty, or @p aLength is larger than the space in a buffer.
+     * @retval kErrorNoBufs       Could not allocate a buffer.
+     */
+    Error ReserveHeadroom(uint16_t aLength);
+
+    /**
+     * Appends bytes to the end of the message.
+     *
+     * @param[in] aBuf     A pointer to the bytes to append.
+     * @param[in] aLength  The number of bytes to append.
+     *
+     * @retval kErrorNone    Successfully appended the bytes.
+     * @retval kErrorNoBufs  Could not allocate the buffers (or the message would be too long). The message is not
+     *                       changed.
+     */
+    Error Append(const void *aBuf, uint16_t aLength);
+
+    /**
+     * Prepends bytes to the start of the message.
+     *
+     * Uses the space at the start of the first buffer (e.g., reserved by `ReserveHeadroom()` or freed by
+     * `RemoveHeader()`) if it is not shared, otherwise allocates a new buffer, filling it from its end to leave space
+     * for more bytes to be prepended later.
+     *
+     * @param[in] aBuf     A pointer to the bytes to prepend.
+     * @param[in] aLength  The number of bytes to prepend.
+     *
+     * @retval kErrorNone    Successfully prepended the bytes.
+     * @retval kErrorNoBufs  Could not allocate the buffers (or the message would be too long). The message is not
+     *                       changed.
+     */
+    Error Prepend(const void *aBuf, uint16_t aLength);
+
+    /**
+     * Removes bytes from the start of the message.
+     *
+     * The space freed at the start of the first buffer (if not shared) can be used by later calls to `Prepend()`.
+     *
+     * @param[in] aLength  The number of bytes to remove.
+     *
+     * @retval kErrorNone         Successfully removed the bytes.
+     * @retval kErrorInvalidArgs  @p aLength is larger than the length of the message. The message is not changed.
+     */
+    Error RemoveHeader(uint16_t aLength);
+
+    /**
+     * Removes bytes from the end of the message.
+     *
+     * @param[in] aLength  The number of bytes to remove.
+     *
+     * @retval kErrorNone         Successfully removed the bytes.
+     * @retval kErrorInvalidArgs  @p aLength is larger than the length of the message. The message is not changed.
+     */
+    Error RemoveFooter(uint16_t aLength);
+
+    /**
+     * Reads bytes from the message.
+     *
+     * @param[in]  aOffset  The offset in the message to read from.
+     * @param[out] aBuf     A pointer to a buffer to output the bytes.
+     * @param[in]  aLength  The number of bytes to read.
+     *
+     * @returns The number of bytes read (smaller than @p aLength if the message ends before).
+     */
+    uint16_t ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const;
+
+    /**
+     * Appends a part of another message to the end of the message, without copying its bytes.
+     *
+     * The bytes are shared with the other message (which is not changed). @p aMessage can be the message itself.
+     *
+     * @param[in] aMessage  The message to append a part of (MUST use the same pool).
+     * @param[in] aOffset   The offset of the part in @p aMessage.
+     * @param[in] aLength   The length of the part.
+     *
+     * @retval kErrorNone         Successfully appended the part.
+     * @retval kErrorInvalidArgs  The part is not within @p aMessage, or @p aMessage uses another pool.
+     * @retval kErrorNoBufs       Could not allocate the buffers (or the message would be too long). The message is not
+     *                            changed.
+     */
+    Error AppendSlice(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
+    /**
+     * Sets another message to a part of the message, without copying its bytes.
+     *
+     * The bytes are shared with the other message. The previous content of @p aSlice is freed.
+     *
+     * @param[in]  aOffset  The offset of the part in the message.
+     * @param[in]  aLength  The length of the part.
+     * @param[out] aSlice   The message to set to the part (MUST use the same pool, and MUST NOT be this message).
+     *
+     * @retval kErrorNone         Successfully set @p aSlice.
+     * @retval kErrorInvalidArgs  The part is not within the message, or @p aSlice uses another pool.
+     * @retval kErrorNoBufs       Could not allocate the buffers. @p aSlice is left empty.
+     */
+    Error Slice(uint16_t aOffset, uint16_t aLength, Message &aSlice) const;
+
+    /**
+     * Sets another message to the whole content of the message, without copying its bytes.
+     *
+     * @param[out] aClone  The message to set (MUST use the same pool, and MUST NOT be this message).
+     *
+     * @retval kErrorNone         Successfully set @p aClone.
+     * @retval kErrorInvalidArgs  @p aClone uses another pool.
+     * @retval kErrorNoBufs       Could not allocate the buffers. @p aClone is left empty.
+     */
+    Error Clone(Message &aClone) const { return Slice(0, mLength, aClone); }
+
+    /**
+     * Gets the first contiguous chunk of the message.
+     *
+     * @param[out] aChunk  A reference to output the chunk.
+     *
+     * @retval kErrorNone      Successfully got the first chunk.
+     * @retval kErrorNotFound  The message is empty.
+     */
+    Error GetFirstChunk(Chunk &aChunk) const;
+
+    /**
+     * Gets the next contiguous chunk of the message.
+     *
+     * @param[in,out] aChunk  On input, the previous chunk (from `GetFirstChunk()` or `GetNextChunk()`). On output, the
+     *                        next chunk.
+     *
+     * @retval kErrorNone      Successfully got the next chunk.
+     * @retval kErrorNotFound  There is no next chunk (reached the end of the message).
+     */
+    Error GetNextChunk(Chunk &aChunk) const;
+
+#if TY_CONFIG_MESSAGE_IOVEC_ENABLE
+    /**
+     * Gets the content of the message as an array of `iovec` (one per chunk), e.g., for `writev()` or `sendmsg()`.
+     *
+     * The `iovec`s point to the bytes of the message, which MUST not be changed while they are used.
+     *
+     * @param[out]    aIoVecs     A pointer to an array of `iovec`s.
+     * @param[in,out] aNumIoVecs  On input, the number of entries in @p aIoVecs. On output, the number of `iovec`s used
+     *                            (or needed on `kErrorNoBufs`).
+     *
+     * @retval kErrorNone    Successfully got the `iovec`s.
+     * @retval kErrorNoBufs  @p aIoVecs is too small.
+     */
+    Error GetIoVecs(struct iovec *aIoVecs, uint16_t &aNumIoVecs) const;
+#endif
+
+private:
+    // A segment is stored at the start of its buffer, followed by its
+    // bytes. Its data (`mData`, `mLength`) is in the bytes of the
+    // `mStorage` segment, which is itself unless it shares the bytes
+    // of another segment. `mRefCount` is the number of references to
+    // the buffer (its own chain link plus the sharing segments).
+
+    struct Segment
+    {
+        uint8_t       *GetStart(void) { return reinterpret_cast<uint8_t *>(this) + kHeaderSize; }
+        uint8_t       *GetEnd(void) { return reinterpret_cast<uint8_t *>(this) + MessagePool::kBufferSize; }
+        uint16_t       GetHeadRoom(void) { return static_cast<uint16_t>(mData - GetStart()); }
+        uint16_t       GetTailRoom(void) { return static_cast<uint16_t>(GetEnd() - (mData + mLength)); }
+        const uint8_t *GetEndOfData(void) const { return mData + mLength; }
+
+        Segment         *mNext;
+        Segment         *mStorage;
+        uint8_t         *mData;
+        uint16_t         mLength;
+        Atomic<uint16_t> mRefCount;
+    };
+
+    static constexpr uint16_t kHeaderSize = (sizeof(Segment) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+    static constexpr uint16_t kDataSize   = MessagePool::kBufferSize - kHeaderSize;
+
+    static_assert(MessagePool::kBufferSize > kHeaderSize, "TY_CONFIG_MESSAGE_BUFFER_SIZE is too small");
+
+    Segment *NewSegment(uint16_t aHeadRoom);
+    void     ReleaseSegment(Segment *aSegment);
+    bool     IsWritable(const Segment &aSegment) const;
+    void     LinkTail(Segment *aSegment);
+    void     RollBack(bool aHadSegment, uint16_t aLength);
+    void     Truncate(uint16_t aLength);
+
+    MessagePool &mPool;
+    Segment     *mHead;
+    Segment     *mTail;
+    uint16_t     mLength;
+};
+
+} // namespace ty
+
+#endif // MESSAGE_HPP_
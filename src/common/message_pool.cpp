@@ -0,0 +1,326 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the message buffer pool.
+ */
+
+#include "message_pool.hpp"
+
+#if TY_CONFIG_MESSAGE_USE_HEAP_ENABLE
+#include "common/heap.hpp"
+#else
+#include <string.h>
+#endif
+
+#include "ty/common/code_utils.hpp"
+
+namespace ty {
+
+void MessagePool::UpdateMaxInUse(uint16_t aNumInUse)
+{
+    uint16_t maxInUse = mMaxInUse.Load(kMemoryOrderRelaxed);
+
+    while (aNumInUse > maxInUse)
+    {
+        if (mMaxInUse.CompareExchangeWeak(maxInUse, aNumInUse, kMemoryOrderRelaxed, kMemoryOrderRelaxed))
+        {
+            break;
+        }
+    }
+}
+
+void MessagePool::GetStats(MemoryStats &aStats) const
+{
+    uint32_t numAllocations = mNumAllocations.Load(kMemoryOrderRelaxed);
+
+    aStats.Clear();
+    aStats.mCapacityBytes  = static_cast<uint32_t>(kNumBuffers) * kBufferSize;
+    aStats.mCurrentBytes   = static_cast<uint32_t>(mNumInUse.Load(kMemoryOrderRelaxed)) * kBufferSize;
+    aStats.mPeakBytes      = static_cast<uint32_t>(mMaxInUse.Load(kMemoryOrderRelaxed)) * kBufferSize;
+    aStats.mNumAllocations = numAllocations;
+    aStats.mNumFrees       = mNumFrees.Load(kMemoryOrderRelaxed);
+    aStats.mNumFailures    = mNumFailures.Load(kMemoryOrderRelaxed);
+
+    aStats.mSizeHistogram[MemoryStats::GetHistogramBucket(kBufferSize)] = numAllocations;
+}
+
+#if TY_CONFIG_MESSAGE_USE_HEAP_ENABLE
+
+MessagePool::MessagePool(void)
+    : mNumInUse(0)
+    , mMaxInUse(0)
+    , mNumAllocations(0)
+    , mNumFrees(0)
+    , mNumFailures(0)
+{
+}
+
+MessagePool::Buffer *MessagePool::NewBuffer(void)
+{
+    Buffer  *buffer   = nullptr;
+    uint16_t numInUse = mNumInUse.Load(kMemoryOrderRelaxed);
+
+    // A buffer is claimed before it is allocated, so that concurrent
+    // allocations never exceed `kNumBuffers`.
+
+    do
+    {
+        VerifyOrExit(numInUse < kNumBuffers);
+    } while (!mNumInUse.CompareExchangeWeak(numInUse, static_cast<uint16_t>(numInUse + 1), kMemoryOrderRelaxed,
+                                            kMemoryOrderRelaxed));
+
+    UpdateMaxInUse(static_cast<uint16_t>(numInUse + 1));
+
+    buffer = static_cast<Buffer *>(Heap::Allocate(sizeof(Buffer), kMemoryTagMessage));
+
+    if (buffer == nullptr)
+    {
+        mNumInUse.FetchSub(1, kMemoryOrderRelaxed);
+    }
+
+exit:
+    if (buffer == nullptr)
+    {
+        mNumFailures.FetchAdd(1, kMemoryOrderRelaxed);
+    }
+    else
+    {
+        mNumAllocations.FetchAdd(1, kMemoryOrderRelaxed);
+    }
+
+    return buffer;
+}
+
+void MessagePool::FreeBuffer(Buffer *aBuffer)
+{
+    VerifyOrExit(aBuffer != nullptr);
+
+    Heap::Free(aBuffer, kMemoryTagMessage);
+    mNumInUse.FetchSub(1, kMemoryOrderRelaxed);
+    mNumFrees.FetchAdd(1, kMemoryOrderRelaxed);
+
+exit:
+    return;
+}
+
+#else // TY_CONFIG_MESSAGE_USE_HEAP_ENABLE
+
+#if TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE > 0
+// Zero (no cache assigned yet) as it has thread storage duration.
+thread_local uint8_t MessagePool::sCacheId;
+Atomic<uint8_t>      MessagePool::sNextCacheId;
+#endif
+
+MessagePool::MessagePool(void)
+    : mFreeHead(0)
+    , mNumInUse(0)
+    , mMaxInUse(0)
+    , mNumAllocations(0)
+    , mNumFrees(0)
+    , mNumFailures(0)
+{
+    for (uint16_t index = 0; index < kNumBuffers; index++)
+    {
+        mNextFree[index].Store((index + 1 < kNumBuffers) ? static_cast<uint16_t>(index + 1) : kNullIndex,
+                               kMemoryOrderRelaxed);
+    }
+}
+
+MessagePool::Buffer *MessagePool::NewBuffer(void)
+{
+    Buffer  *buffer = nullptr;
+    uint16_t index;
+
+#if TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE > 0
+    VerifyOrExit(PopCached(index) || (PopFree(&index, 1) == 1) || StealCached(index));
+#else
+    VerifyOrExit(PopFree(&index, 1) == 1);
+#endif
+
+    buffer = &mBuffers[index];
+
+    UpdateMaxInUse(static_cast<uint16_t>(mNumInUse.FetchAdd(1, kMemoryOrderRelaxed) + 1));
+    mNumAllocations.FetchAdd(1, kMemoryOrderRelaxed);
+
+exit:
+    if (buffer == nullptr)
+    {
+        mNumFailures.FetchAdd(1, kMemoryOrderRelaxed);
+    }
+
+    return buffer;
+}
+
+void MessagePool::FreeBuffer(Buffer *aBuffer)
+{
+    uint16_t index;
+
+    VerifyOrExit(aBuffer != nullptr);
+
+    index = IndexOf(aBuffer);
+
+#if TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE > 0
+    if (!PushCached(index))
+#endif
+    {
+        PushFree(&index, 1);
+    }
+
+    mNumInUse.FetchSub(1, kMemoryOrderRelaxed);
+    mNumFrees.FetchAdd(1, kMemoryOrderRelaxed);
+
+exit:
+    return;
+}
+
+uint16_t MessagePool::PopFree(uint16_t *aIndices, uint16_t aMaxCount)
+{
+    uint32_t head = mFreeHead.Load(kMemoryOrderAcquire);
+    uint16_t count;
+    uint16_t index;
+
+    // Walks down up to `aMaxCount` buffers from the top of the stack
+    // and pops them all at once. If the stack changes meanwhile, the
+    // next indices read may be stale (or even out of range), but the
+    // tag in the head has then changed and the exchange fails.
+
+    do
+    {
+        count = 0;
+        index = static_cast<uint16_t>(head & kIndexMask);
+
+        while ((count < aMaxCount) && (index < kNumBuffers))
+        {
+            aIndices[count++] = index;
+            index             = mNextFree[index].Load(kMemoryOrderRelaxed);
+        }
+
+        VerifyOrExit(count > 0);
+
+    } while (!mFreeHead.CompareExchangeWeak(head, NextHead(head, index), kMemoryOrderAcquire, kMemoryOrderAcquire));
+
+exit:
+    return count;
+}
+
+void MessagePool::PushFree(const uint16_t *aIndices, uint16_t aCount)
+{
+    uint32_t head = mFreeHead.Load(kMemoryOrderRelaxed);
+
+    for (uint16_t i = 0; i + 1 < aCount; i++)
+    {
+        mNextFree[aIndices[i]].Store(aIndices[i + 1], kMemoryOrderRelaxed);
+    }
+
+    do
+    {
+        mNextFree[aIndices[aCount - 1]].Store(static_cast<uint16_t>(head & kIndexMask), kMemoryOrderRelaxed);
+    } while (!mFreeHead.CompareExchangeWeak(head, NextHead(head, aIndices[0]), kMemoryOrderRelease,
+                                            kMemoryOrderRelaxed));
+}
+
+#if TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE > 0
+
+MessagePool::ThreadCache &MessagePool::GetThreadCache(void)
+{
+    // A thread is assigned a cache on its first use of any pool, and
+    // uses the cache with the same index in every pool.
+
+    if (sCacheId == 0)
+    {
+        sCacheId = static_cast<uint8_t>(sNextCacheId.FetchAdd(1, kMemoryOrderRelaxed) % kNumCaches + 1);
+    }
+
+    return mCaches[sCacheId - 1];
+}
+
+bool MessagePool::PopCached(uint16_t &aIndex)
+{
+    ThreadCache &cache = GetThreadCache();
+    bool         found = false;
+
+    VerifyOrExit(cache.TryLock());
+
+    if (cache.mLength == 0)
+    {
+        cache.mLength = PopFree(cache.mIndices, kCacheBatch);
+    }
+
+    if (cache.mLength > 0)
+    {
+        aIndex = cache.mIndices[--cache.mLength];
+        found  = true;
+    }
+
+    cache.Unlock();
+
+exit:
+    return found;
+}
+
+bool MessagePool::PushCached(uint16_t aIndex)
+{
+    ThreadCache &cache  = GetThreadCache();
+    bool         pushed = false;
+
+    VerifyOrExit(cache.TryLock());
+
+    if (cache.mLength == kCacheSize)
+    {
+        // Returns the least recently freed half of the cache to the
+        // shared stack, keeping the most recent (likely still in the
+        // CPU cache) buffers.
+
+        PushFree(cache.mIndices, kCacheBatch);
+        cache.mLength -= kCacheBatch;
+        memmove(cache.mIndices, &cache.mIndices[kCacheBatch], cache.mLength * sizeof(uint16_t));
+    }
+
+    cache.mIndices[cache.mLength++] = aIndex;
+    pushed                          = true;
+
+    cache.Unlock();
+
+exit:
+    return pushed;
+}
+
+bool MessagePool::StealCached(uint16_t &aIndex)
+{
+    // Called when the shared stack is empty, so that the free buffers
+    // in the caches of other threads can still be allocated. A cache
+    // in use by another thread at the same time is skipped.
+
+    bool found = false;
+
+    for (ThreadCache &cache : mCaches)
+    {
+        if (!cache.TryLock())
+        {
+            continue;
+        }
+
+        if (cache.mLength > 0)
+        {
+            aIndex = cache.mIndices[--cache.mLength];
+            found  = true;
+        }
+
+        cache.Unlock();
+
+        if (found)
+        {
+            break;
+        }
+    }
+
+    return found;
+}
+
+#endif // TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE > 0
+
+#endif // TY_CONFIG_MESSAGE_USE_HEAP_ENABLE
+
+} // namespace ty
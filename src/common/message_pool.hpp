@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for the message buffer pool.
+ */
+
+#ifndef MESSAGE_POOL_HPP_
+#define MESSAGE_POOL_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "common/memory_stats.hpp"
+#include "ty/common/atomic.hpp"
+#include "ty/common/non_copyable.hpp"
+
+namespace ty {
+
+/**
+ * Implements a pool of fixed-size message buffers.
+ *
+ * The pool provides `TY_CONFIG_NUM_MESSAGE_BUFFERS` buffers of `TY_CONFIG_MESSAGE_BUFFER_SIZE` bytes each. Allocating
+ * and freeing a buffer take constant time and never use the global allocator, unless
+ * `TY_CONFIG_MESSAGE_USE_HEAP_ENABLE` is set, in which case each buffer is allocated from the heap (see `Heap`) on
+ * demand (still up to `TY_CONFIG_NUM_MESSAGE_BUFFERS` buffers).
+ *
+ * The pool is thread-safe and lock-free. The free buffers are kept in a lock-free stack (linked by buffer index, with a
+ * version tag to detect concurrent changes). If `TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE` is non-zero, the pool also
+ * has `TY_CONFIG_MESSAGE_POOL_NUM_THREAD_CACHES` small caches of free buffers, each used by the threads assigned to it
+ * (round-robin on their first use of a pool), so that allocating and freeing on a thread mostly do not touch the
+ * shared stack, which is then only accessed to move half a cache of buffers at a time.
+ *
+ * The caches are part of the pool, so a thread never keeps buffers of a pool after it is destroyed. A buffer in a cache
+ * is still free: it is counted as such, and a thread which finds the shared stack empty takes one from another cache.
+ */
+class MessagePool : private NonCopyable
+{
+public:
+    static constexpr uint16_t kNumBuffers = TY_CONFIG_NUM_MESSAGE_BUFFERS; ///< Number of buffers in the pool.
+    static constexpr uint16_t kBufferSize = TY_CONFIG_MESSAGE_BUFFER_SIZE; ///< Size of a buffer (in bytes).
+
+    /**
+     * Represents a message buffer.
+     */
+    class Buffer
+    {
+    public:
+        /**
+         * Returns a pointer to the bytes of the buffer (`kBufferSize` bytes).
+         *
+         * @returns A pointer to the bytes of the buffer.
+         */
+        uint8_t *GetBytes(void) { return mBytes; }
+
+        /**
+         * Returns a pointer to the bytes of the buffer (`kBufferSize` bytes).
+         *
+         * @returns A pointer to the bytes of the buffer.
+         */
+        const uint8_t *GetBytes(void) const { return mBytes; }
+
+    private:
+        alignas(uint64_t) uint8_t mBytes[kBufferSize];
+    };
+
+    /**
+     * Initializes the pool with all the buffers free.
+     */
+    MessagePool(void);
+
+    /**
+     * Allocates a buffer from the pool.
+     *
+     * The content of the allocated buffer is undefined.
+     *
+     * @returns A pointer to the allocated buffer, or `nullptr` if there is no free buffer.
+     */
+    Buffer *NewBuffer(void);
+
+    /**
+     * Frees a buffer back to the pool.
+     *
+     * @param[in] aBuffer  A pointer to a buffer allocated from this pool, or `nullptr` (ignored).
+     */
+    void FreeBuffer(Buffer *aBuffer);
+
+    /**
+     * Returns the total number of buffers in the pool.
+     *
+     * @returns The total number of buffers.
+     */
+    uint16_t GetTotalBufferCount(void) const { return kNumBuffers; }
+
+    /**
+     * Returns the number of free buffers in the pool (including those in the per-thread caches).
+     *
+     * @returns The number of free buffers.
+     */
+    uint16_t GetFreeBufferCount(void) const
+    {
+        return static_cast<uint16_t>(kNumBuffers - mNumInUse.Load(kMemoryOrderRelaxed));
+    }
+
+    /**
+     * Returns the maximum number of buffers in use at the same time (the high-water mark) since the pool was
+     * initialized or since the last call to `ResetMaxUsedBufferCount()`.
+     *
+     * @returns The maximum number of buffers in use.
+     */
+    uint16_t GetMaxUsedBufferCount(void) const { return mMaxInUse.Load(kMemoryOrderRelaxed); }
+
+    /**
+     * Resets the high-water mark (see `GetMaxUsedBufferCount()`) to the number of buffers currently in use.
+     */
+    void ResetMaxUsedBufferCount(void) { mMaxInUse.Store(mNumInUse.Load(kMemoryOrderRelaxed), kMemoryOrderRelaxed); }
+
+    /**
+     * Gets the memory usage statistics of the pool.
+     *
+     * @param[out] aStats  A reference to output the statistics.
+     */
+    void GetStats(MemoryStats &aStats) const;
+
+private:
+    static_assert(kNumBuffers > 0, "TY_CONFIG_NUM_MESSAGE_BUFFERS cannot be zero");
+    static_assert(kNumBuffers < 0xffff, "TY_CONFIG_NUM_MESSAGE_BUFFERS is too large");
+
+    void UpdateMaxInUse(uint16_t aNumInUse);
+
+#if TY_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    Atomic<uint16_t> mNumInUse;
+    Atomic<uint16_t> mMaxInUse;
+    Atomic<uint32_t> mNumAllocations;
+    Atomic<uint32_t> mNumFrees;
+    Atomic<uint32_t> mNumFailures;
+#else
+    static constexpr uint16_t kNullIndex = 0xffff;
+    static constexpr uint32_t kIndexMask = 0xffff;
+    static constexpr uint32_t kTagUnit   = 0x10000;
+
+    uint16_t IndexOf(const Buffer *aBuffer) const { return static_cast<uint16_t>(aBuffer - mBuffers); }
+    uint16_t PopFree(uint16_t *aIndices, uint16_t aMaxCount);
+    void     PushFree(const uint16_t *aIndices, uint16_t aCount);
+
+    static uint32_t NextHead(uint32_t aHead, uint16_t aIndex) { return ((aHead & ~kIndexMask) + kTagUnit) | aIndex; }
+
+#if TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE > 0
+    static constexpr uint16_t kCacheSize  = TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE;
+    static constexpr uint16_t kCacheBatch = (kCacheSize + 1) / 2;
+    static constexpr uint8_t  kNumCaches  = TY_CONFIG_MESSAGE_POOL_NUM_THREAD_CACHES;
+
+    static_assert(kNumCaches > 0, "TY_CONFIG_MESSAGE_POOL_NUM_THREAD_CACHES cannot be zero");
+
+    // A cache is only accessed while holding its lock, which is only
+    // ever tried: a thread finding it held uses the shared stack
+    // instead, so no thread waits for another one.
+
+    struct alignas(TY_CONFIG_CACHE_LINE_SIZE) ThreadCache
+    {
+        ThreadCache(void)
+            : mLength(0)
+        {
+        }
+
+        bool TryLock(void) { return !mLocked.Exchange(true, kMemoryOrderAcquire); }
+        void Unlock(void) { mLocked.Store(false, kMemoryOrderRelease); }
+
+        Atomic<bool> mLocked;
+        uint16_t     mLength;
+        uint16_t     mIndices[kCacheSize];
+    };
+
+    ThreadCache &GetThreadCache(void);
+    bool         PopCached(uint16_t &aIndex);
+    bool         PushCached(uint16_t aIndex);
+    bool         StealCached(uint16_t &aIndex);
+
+    static thread_local uint8_t sCacheId;
+    static Atomic<uint8_t>      sNextCacheId;
+#endif
+
+    // The head of the free stack holds the index of the top buffer in
+    // its low 16 bits, and a tag, incremented on every change, in its
+    // high 16 bits. A pop reads the next index of the top buffer
+    // before its compare-and-exchange, so the tag makes it fail if the
+    // top buffer was popped and pushed back meanwhile (ABA problem).
+    // The next indices are kept outside the buffers, so reading a
+    // stale one never races with writes to the buffer bytes.
+
+    alignas(TY_CONFIG_CACHE_LINE_SIZE) Atomic<uint32_t> mFreeHead;
+
+    alignas(TY_CONFIG_CACHE_LINE_SIZE) Atomic<uint16_t> mNumInUse;
+    Atomic<uint16_t>                                    mMaxInUse;
+    Atomic<uint32_t>                                    mNumAllocations;
+    Atomic<uint32_t>                                    mNumFrees;
+    Atomic<uint32_t>                                    mNumFailures;
+
+    Atomic<uint16_t> mNextFree[kNumBuffers];
+    Buffer           mBuffers[kNumBuffers];
+
+#if TY_CONFIG_MESSAGE_POOL_THREAD_CACHE_SIZE > 0
+    ThreadCache mCaches[kNumCaches];
+#endif
+#endif
+};
+
+} // namespace ty
+
+#endif // MESSAGE_POOL_HPP_
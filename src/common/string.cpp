@@ -7,8 +7,10 @@
  */
 
 #include "string.hpp"
+#include "common/encoding.hpp"
 #include "ty/common/debug.hpp"
 
+#include <stddef.h>
 #include <string.h>
 
 namespace ty {
@@ -18,6 +20,94 @@ namespace {
 // The definitions below are included in an unnamed namespace
 // to limit their scope to this translation unit (this file).
 
+// Case folding and case-insensitive comparison process a whole
+// machine word of characters at a time (SWAR). The words are read
+// and written using `memcpy()`, so no alignment is required.
+
+typedef uintptr_t SwarWord;
+
+constexpr SwarWord kSwarLowBits  = ~static_cast<SwarWord>(0) / 0xff; // 0x0101...01
+constexpr SwarWord kSwarHighBits = kSwarLowBits * 0x80;              // 0x8080...80
+constexpr char     kCaseBit      = 'a' - 'A';
+
+SwarWord SwarCaseMask(SwarWord aWord, char aFirst, char aLast)
+{
+    // Returns a word with `kCaseBit` set in every byte of `aWord`
+    // which is in the range [`aFirst`, `aLast`] (all other bytes are
+    // zero). Adding the offsets to the low seven bits of each byte
+    // sets the byte's high bit when it is `>= aFirst` and when it
+    // is `> aLast` respectively, without any carry into the next
+    // byte. Non-ASCII bytes (with high bit set) are never in range.
+
+    SwarWord lowBits = aWord & ~kSwarHighBits;
+    SwarWord geFirst = lowBits + kSwarLowBits * static_cast<uint8_t>(0x80 - aFirst);
+    SwarWord gtLast  = lowBits + kSwarLowBits * static_cast<uint8_t>(0x7f - aLast);
+    SwarWord inRange = (geFirst ^ gtLast) & ~aWord & kSwarHighBits;
+
+    return inRange >> 2;
+}
+
+SwarWord SwarToLowercase(SwarWord aWord)
+{
+    return aWord ^ SwarCaseMask(aWord, 'A', 'Z');
+}
+
+void ConvertCase(char *aString, size_t aLength, char aFirst, char aLast)
+{
+    // Toggles the case of all characters in the range [`aFirst`,
+    // `aLast`], i.e., converts to lowercase for 'A'-'Z' and to
+    // uppercase for 'a'-'z'.
+
+    for (; aLength >= sizeof(SwarWord); aLength -= sizeof(SwarWord), aString += sizeof(SwarWord))
+    {
+        SwarWord word;
+
+        memcpy(&word, aString, sizeof(word));
+        word ^= SwarCaseMask(word, aFirst, aLast);
+        memcpy(aString, &word, sizeof(word));
+    }
+
+    for (; aLength > 0; aLength--, aString++)
+    {
+        if ((aFirst <= *aString) && (*aString <= aLast))
+        {
+            *aString ^= kCaseBit;
+        }
+    }
+}
+
+bool MatchCaseInsensitive(const char *aFirst, const char *aSecond, size_t aLength)
+{
+    // Compares `aLength` characters of two strings ignoring case.
+    // Words which are equal as they are need no case folding.
+
+    bool matches = true;
+
+    for (; aLength >= sizeof(SwarWord); aLength -= sizeof(SwarWord))
+    {
+        SwarWord first;
+        SwarWord second;
+
+        memcpy(&first, aFirst, sizeof(first));
+        memcpy(&second, aSecond, sizeof(second));
+        aFirst += sizeof(SwarWord);
+        aSecond += sizeof(SwarWord);
+
+        if (first != second)
+        {
+            VerifyOrExit(SwarToLowercase(first) == SwarToLowercase(second), matches = false);
+        }
+    }
+
+    for (; aLength > 0; aLength--)
+    {
+        VerifyOrExit(ToLowercase(*aFirst++) == ToLowercase(*aSecond++), matches = false);
+    }
+
+exit:
+    return matches;
+}
+
 enum MatchType : uint8_t
 {
     kNoMatch,
@@ -47,12 +137,18 @@ MatchType Match(const char *aString, const char *aPrefixString, StringMatchMode
         break;
 
     case kStringCaseInsensitiveMatch:
-        while (*aPrefixString != kNullChar)
-        {
-            VerifyOrExit(ToLowercase(*aString++) == ToLowercase(*aPrefixString++));
-        }
+    {
+        // `memchr()` stops at the first null character, so it never
+        // reads past the end of a shorter `aString`.
+
+        size_t prefixLength = strlen(aPrefixString);
+
+        VerifyOrExit(memchr(aString, kNullChar, prefixLength) == nullptr);
+        VerifyOrExit(MatchCaseInsensitive(aString, aPrefixString, prefixLength));
+        aString += prefixLength;
         break;
     }
+    }
 
     match = (*aString == kNullChar) ? kFullMatch : kPrefixMatch;
 
@@ -60,6 +156,199 @@ exit:
     return match;
 }
 
+bool MatchChars(const char *aFirst, const char *aSecond, size_t aLength, StringMatchMode aMode)
+{
+    // Compares `aLength` characters of two strings (which are not
+    // necessarily null-terminated) using match `aMode`.
+
+    bool matches = true;
+
+    switch (aMode)
+    {
+    case kStringExactMatch:
+        matches = (memcmp(aFirst, aSecond, aLength) == 0);
+        break;
+
+    case kStringCaseInsensitiveMatch:
+        matches = MatchCaseInsensitive(aFirst, aSecond, aLength);
+        break;
+    }
+
+    return matches;
+}
+
+// Number of bytes hex encoded at a time by `AppendHexBytes()`.
+constexpr uint16_t kHexBytesChunkLength = 16;
+
+// Number of decimal digits converted in one SWAR step (one `uint64_t`).
+constexpr uint8_t  kSwarDigits    = 8;
+constexpr uint32_t kSwarDigitsPow = 100000000;
+
+uint16_t CountDigits(const char *aString)
+{
+    uint16_t count = 0;
+
+    while (IsDigit(aString[count]) && (count < NumericLimits<uint16_t>::kMax))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+uint32_t ParseEightDigits(const char *aString)
+{
+    // Converts eight decimal digit characters (MUST all be valid
+    // digits) to their numeric value using SWAR. The characters are
+    // packed into a `uint64_t` with the first (most significant)
+    // digit in the lowest byte. The three multiply steps then combine
+    // adjacent digits into pairs, pairs into quads and quads into the
+    // final eight digit value.
+
+    uint64_t chunk = 0;
+
+    for (uint8_t i = 0; i < kSwarDigits; i++)
+    {
+        chunk |= static_cast<uint64_t>(static_cast<uint8_t>(aString[i])) << (i * kBitsPerByte);
+    }
+
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32))) +
+             (((chunk >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32)))) >>
+            32;
+
+    return static_cast<uint32_t>(chunk);
+}
+
+Error ParseDecimal(const char *&aString, uint64_t &aValue, uint64_t aMaxValue)
+{
+    // Parses a run of decimal digits from `aString` as an unsigned
+    // value no larger than `aMaxValue`. Full groups of eight digits
+    // are converted with `ParseEightDigits()`, remaining digits one
+    // at a time. On success `aString` and `aValue` are updated.
+
+    Error       error     = kErrorParse;
+    const char *cur       = aString;
+    uint64_t    value     = 0;
+    uint16_t    numDigits = CountDigits(cur);
+
+    VerifyOrExit(numDigits > 0);
+
+    for (; numDigits >= kSwarDigits; numDigits -= kSwarDigits, cur += kSwarDigits)
+    {
+        uint32_t chunk = ParseEightDigits(cur);
+
+        VerifyOrExit((chunk <= aMaxValue) && (value <= (aMaxValue - chunk) / kSwarDigitsPow));
+        value = value * kSwarDigitsPow + chunk;
+    }
+
+    for (; numDigits > 0; numDigits--, cur++)
+    {
+        uint8_t digit = static_cast<uint8_t>(*cur - '0');
+
+        VerifyOrExit((digit <= aMaxValue) && (value <= (aMaxValue - digit) / 10));
+        value = value * 10 + digit;
+    }
+
+    error   = kErrorNone;
+    aString = cur;
+    aValue  = value;
+
+exit:
+    return error;
+}
+
+Error ParseSignedDecimal(const char *&aString, int64_t &aValue, uint64_t aMaxValue)
+{
+    // Parses an optional sign followed by decimal digits. The
+    // magnitude of a negative number can be one larger than
+    // `aMaxValue` (two's complement minimum value).
+
+    Error       error;
+    const char *cur        = aString;
+    bool        isNegative = false;
+    uint64_t    magnitude;
+
+    if ((*cur == '-') || (*cur == '+'))
+    {
+        isNegative = (*cur == '-');
+        cur++;
+    }
+
+    SuccessOrExit(error = ParseDecimal(cur, magnitude, isNegative ? aMaxValue + 1 : aMaxValue));
+
+    aString = cur;
+    aValue  = isNegative ? static_cast<int64_t>(~magnitude + 1) : static_cast<int64_t>(magnitude);
+
+exit:
+    return error;
+}
+
+Error ParseHex(const char *&aString, uint64_t &aValue, uint64_t aMaxValue)
+{
+    Error       error = kErrorParse;
+    const char *cur   = aString;
+    uint64_t    value = 0;
+    uint8_t     digit;
+
+    if ((cur[0] == '0') && ((cur[1] == 'x') || (cur[1] == 'X')) && (ParseHexDigit(cur[2], digit) == kErrorNone))
+    {
+        cur += 2;
+    }
+
+    while (ParseHexDigit(*cur, digit) == kErrorNone)
+    {
+        VerifyOrExit(value <= (aMaxValue >> 4), error = kErrorParse);
+        value = (value << 4) | digit;
+        VerifyOrExit(value <= aMaxValue, error = kErrorParse);
+        error = kErrorNone;
+        cur++;
+    }
+
+    aString = cur;
+    aValue  = value;
+
+exit:
+    return error;
+}
+
+template <typename UintType> Error ParseUint(const char *&aString, UintType &aUint)
+{
+    Error    error;
+    uint64_t value;
+
+    SuccessOrExit(error = ParseDecimal(aString, value, NumericLimits<UintType>::kMax));
+    aUint = static_cast<UintType>(value);
+
+exit:
+    return error;
+}
+
+template <typename IntType> Error ParseInt(const char *&aString, IntType &aInt)
+{
+    Error   error;
+    int64_t value;
+
+    SuccessOrExit(error = ParseSignedDecimal(aString, value, static_cast<uint64_t>(NumericLimits<IntType>::kMax)));
+    aInt = static_cast<IntType>(value);
+
+exit:
+    return error;
+}
+
+template <typename UintType> Error ParseHexUint(const char *&aString, UintType &aUint)
+{
+    Error    error;
+    uint64_t value;
+
+    SuccessOrExit(error = ParseHex(aString, value, NumericLimits<UintType>::kMax));
+    aUint = static_cast<UintType>(value);
+
+exit:
+    return error;
+}
+
 } // namespace
 
 uint16_t StringLength(const char *aString, uint16_t aMaxLength)
@@ -101,9 +390,13 @@ const char *StringFind(const char *aString, const char *aSubString, StringMatchM
 
     VerifyOrExit(subLen <= len);
 
+    // The lengths are known, so each position is compared with
+    // `MatchChars()`, which stops at the first mismatch, instead of
+    // `Match()`, which first checks the length of the prefix.
+
     for (size_t index = 0; index <= static_cast<size_t>(len - subLen); index++)
     {
-        if (Match(&aString[index], aSubString, aMode) != kNoMatch)
+        if (MatchChars(&aString[index], aSubString, subLen, aMode))
         {
             ExitNow(ret = &aString[index]);
         }
@@ -118,6 +411,35 @@ bool StringStartsWith(const char *aString, const char *aPrefixString, StringMatc
     return Match(aString, aPrefixString, aMode) != kNoMatch;
 }
 
+const char *StringFind(const StringView &aString, char aChar)
+{
+    return static_cast<const char *>(memchr(aString.GetString(), aChar, aString.GetLength()));
+}
+
+const char *StringFind(const StringView &aString, const StringView &aSubString, StringMatchMode aMode)
+{
+    const char *ret = nullptr;
+
+    VerifyOrExit(aSubString.GetLength() <= aString.GetLength());
+
+    for (uint16_t index = 0; index <= aString.GetLength() - aSubString.GetLength(); index++)
+    {
+        if (MatchChars(aString.GetString() + index, aSubString.GetString(), aSubString.GetLength(), aMode))
+        {
+            ExitNow(ret = aString.GetString() + index);
+        }
+    }
+
+exit:
+    return ret;
+}
+
+bool StringStartsWith(const StringView &aString, const StringView &aPrefixString, StringMatchMode aMode)
+{
+    return (aString.GetLength() >= aPrefixString.GetLength()) &&
+           MatchChars(aString.GetString(), aPrefixString.GetString(), aPrefixString.GetLength(), aMode);
+}
+
 bool StringEndsWith(const char *aString, char aChar)
 {
     size_t len = strlen(aString);
@@ -133,6 +455,20 @@ bool StringEndsWith(const char *aString, const char *aSubString, StringMatchMode
     return (subLen > 0) && (len >= subLen) && (Match(&aString[len - subLen], aSubString, aMode) != kNoMatch);
 }
 
+bool StringEndsWith(const StringView &aString, char aChar)
+{
+    return !aString.IsEmpty() && (aString[aString.GetLength() - 1] == aChar);
+}
+
+bool StringEndsWith(const StringView &aString, const StringView &aSubString, StringMatchMode aMode)
+{
+    uint16_t len    = aString.GetLength();
+    uint16_t subLen = aSubString.GetLength();
+
+    return (subLen > 0) && (len >= subLen) &&
+           MatchChars(aString.GetString() + len - subLen, aSubString.GetString(), subLen, aMode);
+}
+
 bool StringMatch(const char *aFirstString, const char *aSecondString)
 {
     return Match(aFirstString, aSecondString, kStringExactMatch) == kFullMatch;
@@ -143,6 +479,25 @@ bool StringMatch(const char *aFirstString, const char *aSecondString, StringMatc
     return Match(aFirstString, aSecondString, aMode) == kFullMatch;
 }
 
+bool StringMatch(const StringView &aFirstString, const StringView &aSecondString, StringMatchMode aMode)
+{
+    return (aFirstString.GetLength() == aSecondString.GetLength()) &&
+           MatchChars(aFirstString.GetString(), aSecondString.GetString(), aFirstString.GetLength(), aMode);
+}
+
+int StringCompare(const StringView &aFirstString, const StringView &aSecondString)
+{
+    int compare = memcmp(aFirstString.GetString(), aSecondString.GetString(),
+                         Min(aFirstString.GetLength(), aSecondString.GetLength()));
+
+    if (compare == 0)
+    {
+        compare = ThreeWayCompare(aFirstString.GetLength(), aSecondString.GetLength());
+    }
+
+    return compare;
+}
+
 Error StringCopy(char *aTargetBuffer, uint16_t aTargetSize, const char *aSource, StringEncodingCheck aEncodingCheck)
 {
     Error    error = kErrorNone;
@@ -172,6 +527,28 @@ exit:
     return error;
 }
 
+Error StringCopy(char *aTargetBuffer, uint16_t aTargetSize, const StringView &aSource, StringEncodingCheck aEncodingCheck)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aSource.GetLength() < aTargetSize, error = kErrorInvalidArgs);
+
+    switch (aEncodingCheck)
+    {
+    case kStringNoEncodingCheck:
+        break;
+    case kStringCheckUtf8Encoding:
+        VerifyOrExit(IsValidUtf8String(aSource), error = kErrorParse);
+        break;
+    }
+
+    memcpy(aTargetBuffer, aSource.GetString(), aSource.GetLength());
+    aTargetBuffer[aSource.GetLength()] = kNullChar;
+
+exit:
+    return error;
+}
+
 Error StringParseUint8(const char *&aString, uint8_t &aUint8)
 {
     return StringParseUint8(aString, aUint8, NumericLimits<uint8_t>::kMax);
@@ -179,41 +556,89 @@ Error StringParseUint8(const char *&aString, uint8_t &aUint8)
 
 Error StringParseUint8(const char *&aString, uint8_t &aUint8, uint8_t aMaxValue)
 {
-    Error       error = kErrorParse;
-    const char *cur   = aString;
-    uint16_t    value = 0;
-    uint8_t     digit;
-
-    while (ParseDigit(*cur, digit) == kErrorNone)
-    {
-        value *= 10;
-        value += digit;
-        VerifyOrExit(value <= aMaxValue, error = kErrorParse);
-        error = kErrorNone;
-        cur++;
-    }
+    Error    error;
+    uint64_t value;
 
-    aString = cur;
-    aUint8  = static_cast<uint8_t>(value);
+    SuccessOrExit(error = ParseDecimal(aString, value, aMaxValue));
+    aUint8 = static_cast<uint8_t>(value);
 
 exit:
     return error;
 }
 
+Error StringParseUint16(const char *&aString, uint16_t &aUint16)
+{
+    return ParseUint(aString, aUint16);
+}
+
+Error StringParseUint32(const char *&aString, uint32_t &aUint32)
+{
+    return ParseUint(aString, aUint32);
+}
+
+Error StringParseUint64(const char *&aString, uint64_t &aUint64)
+{
+    return ParseUint(aString, aUint64);
+}
+
+Error StringParseInt8(const char *&aString, int8_t &aInt8)
+{
+    return ParseInt(aString, aInt8);
+}
+
+Error StringParseInt16(const char *&aString, int16_t &aInt16)
+{
+    return ParseInt(aString, aInt16);
+}
+
+Error StringParseInt32(const char *&aString, int32_t &aInt32)
+{
+    return ParseInt(aString, aInt32);
+}
+
+Error StringParseInt64(const char *&aString, int64_t &aInt64)
+{
+    return ParseInt(aString, aInt64);
+}
+
+Error StringParseHexUint8(const char *&aString, uint8_t &aUint8)
+{
+    return ParseHexUint(aString, aUint8);
+}
+
+Error StringParseHexUint16(const char *&aString, uint16_t &aUint16)
+{
+    return ParseHexUint(aString, aUint16);
+}
+
+Error StringParseHexUint32(const char *&aString, uint32_t &aUint32)
+{
+    return ParseHexUint(aString, aUint32);
+}
+
+Error StringParseHexUint64(const char *&aString, uint64_t &aUint64)
+{
+    return ParseHexUint(aString, aUint64);
+}
+
 void StringConvertToLowercase(char *aString)
 {
-    for (; *aString != kNullChar; aString++)
-    {
-        *aString = ToLowercase(*aString);
-    }
+    ConvertCase(aString, strlen(aString), 'A', 'Z');
 }
 
 void StringConvertToUppercase(char *aString)
 {
-    for (; *aString != kNullChar; aString++)
-    {
-        *aString = ToUppercase(*aString);
-    }
+    ConvertCase(aString, strlen(aString), 'a', 'z');
+}
+
+void StringConvertToLowercase(char *aString, uint16_t aLength)
+{
+    ConvertCase(aString, aLength, 'A', 'Z');
+}
+
+void StringConvertToUppercase(char *aString, uint16_t aLength)
+{
+    ConvertCase(aString, aLength, 'a', 'z');
 }
 
 char ToLowercase(char aChar)
@@ -241,6 +666,11 @@ bool IsDigit(char aChar)
     return ('0' <= aChar && aChar <= '9');
 }
 
+bool IsWhitespace(char aChar)
+{
+    return (aChar == ' ') || ('\t' <= aChar && aChar <= '\r');
+}
+
 bool IsUppercase(char aChar)
 {
     return ('A' <= aChar && aChar <= 'Z');
@@ -304,6 +734,15 @@ StringWriter &StringWriter::Clear(void)
     return *this;
 }
 
+void StringWriter::CopyFrom(const StringWriter &aOther)
+{
+    uint16_t length = Min(aOther.GetBufferedLength(), static_cast<uint16_t>(mSize - 1));
+
+    memcpy(mBuffer, aOther.mBuffer, length);
+    mBuffer[length] = kNullChar;
+    mLength         = aOther.mLength;
+}
+
 StringWriter &StringWriter::Append(const char *aFormat, ...)
 {
     va_list args;
@@ -331,11 +770,36 @@ StringWriter &StringWriter::AppendVarArgs(const char *aFormat, va_list aArgs)
     return *this;
 }
 
+StringWriter &StringWriter::Append(const StringView &aString)
+{
+    uint16_t length = aString.GetLength();
+
+    if (mLength < mSize)
+    {
+        uint16_t copyLength = Min(length, static_cast<uint16_t>(mSize - mLength - 1));
+
+        memcpy(&mBuffer[mLength], aString.GetString(), copyLength);
+        mBuffer[mLength + copyLength] = kNullChar;
+    }
+
+    mLength += length;
+
+    return *this;
+}
+
 StringWriter &StringWriter::AppendHexBytes(const uint8_t *aBytes, uint16_t aLength)
 {
-    while (aLength--)
+    char hexString[HexEncodedLength(kHexBytesChunkLength) + 1];
+
+    while (aLength > 0)
     {
-        Append("%02x", *aBytes++);
+        uint16_t length = Min(aLength, kHexBytesChunkLength);
+
+        SuccessOrAssert(HexEncode(aBytes, length, hexString, sizeof(hexString)));
+        Append(StringView(hexString, static_cast<uint16_t>(HexEncodedLength(length))));
+
+        aBytes += length;
+        aLength -= length;
     }
 
     return *this;
@@ -351,11 +815,462 @@ StringWriter &StringWriter::AppendCharMultipleTimes(char aChar, uint16_t aCount)
     return *this;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// StreamingStringWriter
+
+StreamingStringWriter::StreamingStringWriter(char *aBuffer, uint16_t aSize, FlushHandler aHandler, void *aContext)
+    : mBuffer(aBuffer)
+    , mLength(0)
+    , mSize(aSize)
+    , mFlushedLength(0)
+    , mHandler(aHandler)
+    , mContext(aContext)
+{
+    TY_ASSERT(aSize >= 2);
+    mBuffer[0] = kNullChar;
+}
+
+StreamingStringWriter &StreamingStringWriter::Append(const char *aFormat, ...)
+{
+    va_list args;
+    va_start(args, aFormat);
+    AppendVarArgs(aFormat, args);
+    va_end(args);
+
+    return *this;
+}
+
+StreamingStringWriter &StreamingStringWriter::AppendVarArgs(const char *aFormat, va_list aArgs)
+{
+    // The common case is an output which fits in the remaining
+    // buffer space. Otherwise the buffer is flushed and the output
+    // is formatted again. Only when the output is larger than the
+    // whole buffer, the format string is split into its individual
+    // conversions.
+
+    VerifyOrExit(!TryAppend(aFormat, aArgs));
+
+    if (mLength > 0)
+    {
+        Flush();
+        VerifyOrExit(!TryAppend(aFormat, aArgs));
+    }
+
+    AppendConversions(aFormat, aArgs);
+
+exit:
+    return *this;
+}
+
+StreamingStringWriter &StreamingStringWriter::Append(const StringView &aString)
+{
+    const char *chars  = aString.GetString();
+    uint16_t    length = aString.GetLength();
+
+    while (length > 0)
+    {
+        uint16_t copyLength;
+
+        if (GetAvailable() == 0)
+        {
+            Flush();
+        }
+
+        copyLength = Min(length, GetAvailable());
+        memcpy(&mBuffer[mLength], chars, copyLength);
+
+        mLength += copyLength;
+        chars += copyLength;
+        length -= copyLength;
+        mBuffer[mLength] = kNullChar;
+    }
+
+    return *this;
+}
+
+StreamingStringWriter &StreamingStringWriter::AppendHexBytes(const uint8_t *aBytes, uint16_t aLength)
+{
+    char hexString[HexEncodedLength(kHexBytesChunkLength) + 1];
+
+    while (aLength > 0)
+    {
+        uint16_t length = Min(aLength, kHexBytesChunkLength);
+
+        SuccessOrAssert(HexEncode(aBytes, length, hexString, sizeof(hexString)));
+        Append(StringView(hexString, static_cast<uint16_t>(HexEncodedLength(length))));
+
+        aBytes += length;
+        aLength -= length;
+    }
+
+    return *this;
+}
+
+StreamingStringWriter &StreamingStringWriter::AppendCharMultipleTimes(char aChar, uint16_t aCount)
+{
+    while (aCount > 0)
+    {
+        uint16_t count;
+
+        if (GetAvailable() == 0)
+        {
+            Flush();
+        }
+
+        count = Min(aCount, GetAvailable());
+        memset(&mBuffer[mLength], aChar, count);
+
+        mLength += count;
+        aCount -= count;
+        mBuffer[mLength] = kNullChar;
+    }
+
+    return *this;
+}
+
+StreamingStringWriter &StreamingStringWriter::Flush(void)
+{
+    VerifyOrExit(mLength > 0);
+
+    mHandler(mBuffer, mLength, mContext);
+
+    mFlushedLength += mLength;
+    mLength    = 0;
+    mBuffer[0] = kNullChar;
+
+exit:
+    return *this;
+}
+
+bool StreamingStringWriter::TryAppend(const char *aFormat, va_list aArgs)
+{
+    // Formats into the remaining buffer space. If the output does not
+    // fit, the buffer content is left unchanged and `false` is
+    // returned. `aArgs` is copied, so the caller can use it again.
+
+    bool    fits;
+    int     len;
+    va_list args;
+
+    va_copy(args, aArgs);
+    len = vsnprintf(&mBuffer[mLength], static_cast<size_t>(mSize - mLength), aFormat, args);
+    va_end(args);
+
+    TY_ASSERT(len >= 0);
+
+    fits = (len <= GetAvailable());
+
+    if (fits)
+    {
+        mLength += static_cast<uint16_t>(len);
+    }
+    else
+    {
+        mBuffer[mLength] = kNullChar;
+    }
+
+    return fits;
+}
+
+void StreamingStringWriter::AppendConversion(const char *aSpec, ...)
+{
+    // Appends a single conversion. If it does not fit even in an
+    // empty buffer, it is truncated to the buffer size.
+
+    va_list args;
+
+    va_start(args, aSpec);
+
+    VerifyOrExit(!TryAppend(aSpec, args));
+    Flush();
+    VerifyOrExit(!TryAppend(aSpec, args));
+
+    vsnprintf(mBuffer, mSize, aSpec, args);
+    mLength = static_cast<uint16_t>(mSize - 1);
+
+exit:
+    va_end(args);
+}
+
+void StreamingStringWriter::AppendConversions(const char *aFormat, va_list aArgs)
+{
+    // Appends the formatted output one conversion specification at a
+    // time. The literal text between the conversions and the string
+    // (`%s`) arguments are appended as string views which are
+    // flushed in chunks. Every other conversion is formatted on its
+    // own (as `%<flags><width>.<precision><length><conversion>`)
+    // after its argument is read from `aArgs` based on its type.
+
+    enum LengthModifier : uint8_t
+    {
+        kLengthNone,
+        kLengthLong,
+        kLengthLongLong,
+        kLengthIntMax,
+        kLengthSize,
+        kLengthPtrDiff,
+        kLengthLongDouble,
+    };
+
+    while (*aFormat != kNullChar)
+    {
+        const char          *start = aFormat;
+        String<kMaxSpecSize> spec;
+        LengthModifier       lengthModifier = kLengthNone;
+        bool                 leftAlign      = false;
+        int                  width          = 0;
+        int                  precision      = -1;
+        char                 conversion;
+
+        while ((*aFormat != kNullChar) && (*aFormat != '%'))
+        {
+            aFormat++;
+        }
+
+        Append(StringView(start, static_cast<uint16_t>(aFormat - start)));
+
+        VerifyOrExit(*aFormat == '%');
+        aFormat++;
+
+        spec.Append("%%");
+
+        while ((*aFormat != kNullChar) && (StringFind("-+ #0", *aFormat) != nullptr))
+        {
+            leftAlign |= (*aFormat == '-');
+            spec.Append("%c", *aFormat++);
+        }
+
+        if (*aFormat == '*')
+        {
+            aFormat++;
+            width = va_arg(aArgs, int);
+
+            if (width < 0)
+            {
+                leftAlign = true;
+                width     = -width;
+                spec.Append("-");
+            }
+        }
+        else
+        {
+            for (; IsDigit(*aFormat); aFormat++)
+            {
+                width = width * 10 + (*aFormat - '0');
+            }
+        }
+
+        if (width > 0)
+        {
+            spec.Append("%d", width);
+        }
+
+        if (*aFormat == '.')
+        {
+            aFormat++;
+
+            if (*aFormat == '*')
+            {
+                aFormat++;
+                precision = va_arg(aArgs, int);
+            }
+            else
+            {
+                for (precision = 0; IsDigit(*aFormat); aFormat++)
+                {
+                    precision = precision * 10 + (*aFormat - '0');
+                }
+            }
+        }
+
+        if (precision >= 0)
+        {
+            spec.Append(".%d", precision);
+        }
+
+        while ((*aFormat != kNullChar) && (StringFind("hljztL", *aFormat) != nullptr))
+        {
+            switch (*aFormat)
+            {
+            case 'l':
+                lengthModifier = (lengthModifier == kLengthLong) ? kLengthLongLong : kLengthLong;
+                break;
+            case 'j':
+                lengthModifier = kLengthIntMax;
+                break;
+            case 'z':
+                lengthModifier = kLengthSize;
+                break;
+            case 't':
+                lengthModifier = kLengthPtrDiff;
+                break;
+            case 'L':
+                lengthModifier = kLengthLongDouble;
+                break;
+            default:
+                break;
+            }
+
+            spec.Append("%c", *aFormat++);
+        }
+
+        conversion = *aFormat;
+        VerifyOrExit(conversion != kNullChar);
+        aFormat++;
+
+        spec.Append("%c", conversion);
+
+        switch (conversion)
+        {
+        case '%':
+            Append(StringView("%", 1));
+            break;
+
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            // The signed and unsigned variants of each type have the
+            // same size and are passed the same way.
+            switch (lengthModifier)
+            {
+            case kLengthLong:
+                AppendConversion(spec.AsCString(), va_arg(aArgs, unsigned long));
+                break;
+            case kLengthLongLong:
+                AppendConversion(spec.AsCString(), va_arg(aArgs, unsigned long long));
+                break;
+            case kLengthIntMax:
+                AppendConversion(spec.AsCString(), va_arg(aArgs, uintmax_t));
+                break;
+            case kLengthSize:
+                AppendConversion(spec.AsCString(), va_arg(aArgs, size_t));
+                break;
+            case kLengthPtrDiff:
+                AppendConversion(spec.AsCString(), va_arg(aArgs, ptrdiff_t));
+                break;
+            default:
+                AppendConversion(spec.AsCString(), va_arg(aArgs, unsigned int));
+                break;
+            }
+            break;
+
+        case 'c':
+            AppendConversion(spec.AsCString(), va_arg(aArgs, int));
+            break;
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (lengthModifier == kLengthLongDouble)
+            {
+                AppendConversion(spec.AsCString(), va_arg(aArgs, long double));
+            }
+            else
+            {
+                AppendConversion(spec.AsCString(), va_arg(aArgs, double));
+            }
+            break;
+
+        case 's':
+            if (lengthModifier == kLengthNone)
+            {
+                const char *string = va_arg(aArgs, const char *);
+
+                if (string == nullptr)
+                {
+                    string = "(null)";
+                }
+
+                AppendPadded(string, precision, width, leftAlign);
+                break;
+            }
+
+            // Wide strings are formatted as a single conversion.
+            TY_FALL_THROUGH;
+
+        case 'p':
+            AppendConversion(spec.AsCString(), va_arg(aArgs, void *));
+            break;
+
+        case 'n':
+            // Writing back the output length is not supported,
+            // the argument is skipped.
+            {
+                void *pointer = va_arg(aArgs, void *);
+
+                TY_UNUSED_VARIABLE(pointer);
+            }
+            break;
+
+        default:
+            // Unknown conversion, appended as it is.
+            Append(StringView(spec.AsCString(), spec.GetLength()));
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+void StreamingStringWriter::AppendPadded(const char *aString, int aPrecision, int aWidth, bool aLeftAlign)
+{
+    // Appends a `%s` conversion along with its precision (maximum
+    // number of characters) and its field width. The string is
+    // appended in chunks, so its length is not limited by the
+    // buffer size.
+
+    size_t   length  = 0;
+    uint16_t padding = 0;
+
+    while ((aString[length] != kNullChar) && ((aPrecision < 0) || (length < static_cast<size_t>(aPrecision))))
+    {
+        length++;
+    }
+
+    if (static_cast<size_t>(aWidth) > length)
+    {
+        padding = static_cast<uint16_t>(Min<size_t>(static_cast<size_t>(aWidth) - length, NumericLimits<uint16_t>::kMax));
+    }
+
+    if (!aLeftAlign)
+    {
+        AppendCharMultipleTimes(' ', padding);
+    }
+
+    while (length > 0)
+    {
+        uint16_t chunkLength = static_cast<uint16_t>(Min<size_t>(length, NumericLimits<uint16_t>::kMax));
+
+        Append(StringView(aString, chunkLength));
+        aString += chunkLength;
+        length -= chunkLength;
+    }
+
+    if (aLeftAlign)
+    {
+        AppendCharMultipleTimes(' ', padding);
+    }
+}
+
 bool IsValidUtf8String(const char *aString)
 {
     return IsValidUtf8String(aString, strlen(aString));
 }
 
+bool IsValidUtf8String(const StringView &aString)
+{
+    return IsValidUtf8String(aString.GetString(), aString.GetLength());
+}
+
 bool IsValidUtf8String(const char *aString, size_t aLength)
 {
     bool    ret = true;
@@ -18,6 +18,7 @@
 #include "ty/common/binary_search.hpp"
 #include "ty/common/code_utils.hpp"
 #include "ty/common/error.hpp"
+#include "ty/common/hash.hpp"
 #include "ty/common/num_utils.hpp"
 
 #include "ty/platform/toolchain.h"
@@ -64,6 +65,113 @@ static constexpr char kNullChar = '\0'; ///< null character.
  */
 uint16_t StringLength(const char *aString, uint16_t aMaxLength);
 
+/**
+ * Represents a read-only view of a sequence of characters (a pointer and a length).
+ *
+ * The viewed characters are not required to be null-terminated, so a `StringView` can refer to a sub-string (e.g., a
+ * token) within a larger buffer without copying it. The `StringView` does not own the characters, the caller MUST
+ * ensure that the underlying buffer remains valid while the `StringView` is used.
+ */
+class StringView
+{
+public:
+    /**
+     * Initializes the `StringView` as empty.
+     */
+    StringView(void)
+        : mString("")
+        , mLength(0)
+    {
+    }
+
+    /**
+     * Initializes the `StringView` from a pointer to characters and a length.
+     *
+     * @param[in] aString   A pointer to the characters (not required to be null-terminated).
+     * @param[in] aLength   The number of characters in @p aString.
+     */
+    StringView(const char *aString, uint16_t aLength)
+        : mString(aString)
+        , mLength(aLength)
+    {
+    }
+
+    /**
+     * Initializes the `StringView` from a null-terminated C string.
+     *
+     * @param[in] aCString  A pointer to a null-terminated string. Can be `nullptr` which is treated as "".
+     */
+    StringView(const char *aCString)
+        : mString((aCString != nullptr) ? aCString : "")
+        , mLength(StringLength(aCString, NumericLimits<uint16_t>::kMax))
+    {
+    }
+
+    /**
+     * Returns the pointer to the first character in the view.
+     *
+     * @note The characters are not necessarily null-terminated.
+     *
+     * @returns The pointer to the first character.
+     */
+    const char *GetString(void) const { return mString; }
+
+    /**
+     * Returns the length of the view (number of characters).
+     *
+     * @returns The length of the view.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * Indicates whether or not the view is empty.
+     *
+     * @retval TRUE   The view is empty.
+     * @retval FALSE  The view is not empty.
+     */
+    bool IsEmpty(void) const { return (mLength == 0); }
+
+    /**
+     * Overloads the `[]` operator to get the character at a given index.
+     *
+     * Does not perform index bounds checking. Behavior is undefined if @p aIndex is not valid.
+     *
+     * @param[in] aIndex  The index to get.
+     *
+     * @returns The character at @p aIndex.
+     */
+    char operator[](uint16_t aIndex) const { return mString[aIndex]; }
+
+    /**
+     * Gets a sub-view of the view.
+     *
+     * The @p aOffset and @p aLength are clamped to the current view, so the returned sub-view is always within the
+     * view.
+     *
+     * @param[in] aOffset   The offset of the first character of the sub-view.
+     * @param[in] aLength   The maximum length of the sub-view.
+     *
+     * @returns The sub-view.
+     */
+    StringView GetSubView(uint16_t aOffset, uint16_t aLength = NumericLimits<uint16_t>::kMax) const
+    {
+        aOffset = Min(aOffset, mLength);
+
+        return StringView(mString + aOffset, Min(aLength, static_cast<uint16_t>(mLength - aOffset)));
+    }
+
+    // The following methods are intended to support range-based `for`
+    // loop iteration over the characters and should not be used
+    // directly.
+
+    const char *begin(void) const { return mString; }
+    const char *end(void) const { return mString + mLength; }
+
+private:
+    const char *mString;
+    uint16_t    mLength;
+};
+
 /**
  * Finds the first occurrence of a given character in a null-terminated string.
  *
@@ -86,6 +194,30 @@ const char *StringFind(const char *aString, char aChar);
  */
 const char *StringFind(const char *aString, const char *aSubString, StringMatchMode aMode = kStringExactMatch);
 
+/**
+ * Finds the first occurrence of a given character in a string view.
+ *
+ * @param[in] aString     The string view to search in.
+ * @param[in] aChar       A char to search for in the string.
+ *
+ * @returns The pointer to first occurrence of the @p aChar in @p aString, or `nullptr` if cannot be found.
+ */
+const char *StringFind(const StringView &aString, char aChar);
+
+/**
+ * Finds the first occurrence of a given sub-string in a string view.
+ *
+ * @param[in] aString     The string view to search in.
+ * @param[in] aSubString  A sub-string to search for.
+ * @param[in] aMode       The string comparison mode, exact match or case insensitive match.
+ *
+ * @returns The pointer to first match of the @p aSubString in @p aString (using comparison @p aMode), or `nullptr` if
+ *          cannot be found.
+ */
+const char *StringFind(const StringView &aString,
+                       const StringView &aSubString,
+                       StringMatchMode   aMode = kStringExactMatch);
+
 /**
  * Checks whether a null-terminated string starts with a given prefix string.
  *
@@ -98,6 +230,20 @@ const char *StringFind(const char *aString, const char *aSubString, StringMatchM
  */
 bool StringStartsWith(const char *aString, const char *aPrefixString, StringMatchMode aMode = kStringExactMatch);
 
+/**
+ * Checks whether a string view starts with a given prefix string.
+ *
+ * @param[in] aString         The string view.
+ * @param[in] aPrefixString   A prefix string.
+ * @param[in] aMode           The string comparison mode, exact match or case insensitive match.
+ *
+ * @retval TRUE   If @p aString starts with @p aPrefixString.
+ * @retval FALSE  If @p aString does not start with @p aPrefixString.
+ */
+bool StringStartsWith(const StringView &aString,
+                      const StringView &aPrefixString,
+                      StringMatchMode   aMode = kStringExactMatch);
+
 /**
  * Checks whether a null-terminated string ends with a given character.
  *
@@ -121,6 +267,29 @@ bool StringEndsWith(const char *aString, char aChar);
  */
 bool StringEndsWith(const char *aString, const char *aSubString, StringMatchMode aMode = kStringExactMatch);
 
+/**
+ * Checks whether a string view ends with a given character.
+ *
+ * @param[in] aString  The string view.
+ * @param[in] aChar    A char to check.
+ *
+ * @retval TRUE   If @p aString ends with character @p aChar.
+ * @retval FALSE  If @p aString does not end with character @p aChar.
+ */
+bool StringEndsWith(const StringView &aString, char aChar);
+
+/**
+ * Checks whether a string view ends with a given sub-string.
+ *
+ * @param[in] aString      The string view.
+ * @param[in] aSubString   A sub-string to check against.
+ * @param[in] aMode        The string comparison mode, exact match or case insensitive match.
+ *
+ * @retval TRUE   If @p aString ends with sub-string @p aSubString.
+ * @retval FALSE  If @p aString does not end with sub-string @p aSubString.
+ */
+bool StringEndsWith(const StringView &aString, const StringView &aSubString, StringMatchMode aMode = kStringExactMatch);
+
 /**
  * Checks whether or not two null-terminated strings match exactly.
  *
@@ -144,6 +313,34 @@ bool StringMatch(const char *aFirstString, const char *aSecondString);
  */
 bool StringMatch(const char *aFirstString, const char *aSecondString, StringMatchMode aMode);
 
+/**
+ * Checks whether or not two string views match.
+ *
+ * @param[in] aFirstString   The first string view.
+ * @param[in] aSecondString  The second string view.
+ * @param[in] aMode          The string comparison mode, exact match or case insensitive match.
+ *
+ * @retval TRUE   If @p aFirstString matches @p aSecondString using match mode @p aMode.
+ * @retval FALSE  If @p aFirstString does not match @p aSecondString using match mode @p aMode.
+ */
+bool StringMatch(const StringView &aFirstString,
+                 const StringView &aSecondString,
+                 StringMatchMode   aMode = kStringExactMatch);
+
+/**
+ * Compares two string views in lexicographical order.
+ *
+ * The characters are compared as `unsigned char` values (similar to `strcmp()`). If one view is a prefix of the
+ * other, the shorter one is ordered first.
+ *
+ * @param[in] aFirstString   The first string view.
+ * @param[in] aSecondString  The second string view.
+ *
+ * @returns Zero if the views are equal, a negative value if @p aFirstString is ordered before @p aSecondString, or a
+ *          positive value if @p aFirstString is ordered after @p aSecondString.
+ */
+int StringCompare(const StringView &aFirstString, const StringView &aSecondString);
+
 /**
  * Copies a string into a given target buffer with a given size if it fits.
  *
@@ -179,6 +376,46 @@ Error StringCopy(char (&aTargetBuffer)[kSize],
     return StringCopy(aTargetBuffer, kSize, aSource, aEncodingCheck);
 }
 
+/**
+ * Copies a string view into a given target buffer with a given size if it fits.
+ *
+ * The copied string in @p aTargetBuffer is always null-terminated.
+ *
+ * @param[out] aTargetBuffer  A pointer to the target buffer to copy into.
+ * @param[out] aTargetSize    The size (number of characters) in @p aTargetBuffer array.
+ * @param[in]  aSource        The string view to copy from.
+ * @param[in]  aEncodingCheck Specifies the encoding format check (e.g., UTF-8) to perform.
+ *
+ * @retval kErrorNone         The @p aSource fits in the given buffer. @p aTargetBuffer is updated.
+ * @retval kErrorInvalidArgs  The @p aSource does not fit in the given buffer.
+ * @retval kErrorParse        The @p aSource does not follow the encoding format specified by @p aEncodingCheck.
+ */
+Error StringCopy(char               *aTargetBuffer,
+                 uint16_t            aTargetSize,
+                 const StringView   &aSource,
+                 StringEncodingCheck aEncodingCheck);
+
+/**
+ * Copies a string view into a given target buffer with a given size if it fits.
+ *
+ * @tparam kSize  The size of buffer.
+ *
+ * @param[out] aTargetBuffer  A reference to the target buffer array to copy into.
+ * @param[in]  aSource        The string view to copy from.
+ * @param[in]  aEncodingCheck Specifies the encoding format check (e.g., UTF-8) to perform.
+ *
+ * @retval kErrorNone         The @p aSource fits in the given buffer. @p aTargetBuffer is updated.
+ * @retval kErrorInvalidArgs  The @p aSource does not fit in the given buffer.
+ * @retval kErrorParse        The @p aSource does not follow the encoding format specified by @p aEncodingCheck.
+ */
+template <uint16_t kSize>
+Error StringCopy(char (&aTargetBuffer)[kSize],
+                 const StringView   &aSource,
+                 StringEncodingCheck aEncodingCheck = kStringNoEncodingCheck)
+{
+    return StringCopy(aTargetBuffer, kSize, aSource, aEncodingCheck);
+}
+
 /**
  * Parses a decimal number from a string as `uint8_t` and skips over the parsed characters.
  *
@@ -216,6 +453,225 @@ Error StringParseUint8(const char *&aString, uint8_t &aUint8, uint8_t aMaxValue)
  */
 Error StringParseUint8(const char *&aString, uint8_t &aUint8);
 
+/**
+ * Parses a decimal number from a string as `uint16_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseUint8()`, i.e., all the digit characters in the string are parsed until reaching a
+ * non-digit character and the pointer `aString` is updated to point to the first non-digit character.
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aUint16    A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aUint16 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseUint16(const char *&aString, uint16_t &aUint16);
+
+/**
+ * Parses a decimal number from a string as `uint32_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseUint8()`, i.e., all the digit characters in the string are parsed until reaching a
+ * non-digit character and the pointer `aString` is updated to point to the first non-digit character.
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aUint32    A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aUint32 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseUint32(const char *&aString, uint32_t &aUint32);
+
+/**
+ * Parses a decimal number from a string as `uint64_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseUint8()`, i.e., all the digit characters in the string are parsed until reaching a
+ * non-digit character and the pointer `aString` is updated to point to the first non-digit character.
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aUint64    A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aUint64 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseUint64(const char *&aString, uint64_t &aUint64);
+
+/**
+ * Parses a signed decimal number from a string as `int8_t` and skips over the parsed characters.
+ *
+ * The number can start with an optional sign character ('+' or '-') followed by the digit characters. All the digit
+ * characters are parsed until reaching a non-digit character. The pointer `aString` is updated to point to the first
+ * non-digit character after the parsed digits.
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aInt8      A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aInt8 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseInt8(const char *&aString, int8_t &aInt8);
+
+/**
+ * Parses a signed decimal number from a string as `int16_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseInt8()` (see the description of `StringParseInt8()` for more details).
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aInt16     A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aInt16 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseInt16(const char *&aString, int16_t &aInt16);
+
+/**
+ * Parses a signed decimal number from a string as `int32_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseInt8()` (see the description of `StringParseInt8()` for more details).
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aInt32     A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aInt32 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseInt32(const char *&aString, int32_t &aInt32);
+
+/**
+ * Parses a signed decimal number from a string as `int64_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseInt8()` (see the description of `StringParseInt8()` for more details).
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aInt64     A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aInt64 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseInt64(const char *&aString, int64_t &aInt64);
+
+/**
+ * Parses a hexadecimal number from a string as `uint8_t` and skips over the parsed characters.
+ *
+ * The number can start with an optional "0x" or "0X" prefix followed by the hex digit characters ('0'-'9', 'A'-'F',
+ * or 'a'-'f'). All the hex digit characters are parsed until reaching a non-hex-digit character. The pointer `aString`
+ * is updated to point to the first character after the parsed hex digits.
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aUint8     A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aUint8 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseHexUint8(const char *&aString, uint8_t &aUint8);
+
+/**
+ * Parses a hexadecimal number from a string as `uint16_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseHexUint8()` (see the description of `StringParseHexUint8()` for more details).
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aUint16    A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aUint16 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseHexUint16(const char *&aString, uint16_t &aUint16);
+
+/**
+ * Parses a hexadecimal number from a string as `uint32_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseHexUint8()` (see the description of `StringParseHexUint8()` for more details).
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aUint32    A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aUint32 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseHexUint32(const char *&aString, uint32_t &aUint32);
+
+/**
+ * Parses a hexadecimal number from a string as `uint64_t` and skips over the parsed characters.
+ *
+ * Behaves similar to `StringParseHexUint8()` (see the description of `StringParseHexUint8()` for more details).
+ *
+ * @param[in,out] aString    A reference to a pointer to string to parse.
+ * @param[out]    aUint64    A reference to return the parsed value.
+ *
+ * @retval kErrorNone   Successfully parsed the number from string. @p aString and @p aUint64 are updated.
+ * @retval kErrorParse  Failed to parse the number from @p aString, or parsed number is out of range.
+ */
+Error StringParseHexUint64(const char *&aString, uint64_t &aUint64);
+
+/**
+ * Checks whether a given character is a whitespace character (' ', '\t', '\n', '\v', '\f', or '\r').
+ *
+ * @param[in] aChar   The character to check.
+ *
+ * @retval TRUE    @p aChar is a whitespace character.
+ * @retval FALSE   @p aChar is not a whitespace character.
+ */
+bool IsWhitespace(char aChar);
+
+/**
+ * Parses a list of numbers from a string separated by whitespace and/or comma characters.
+ *
+ * Each value in the list is parsed using the given @p aParser function, e.g., `StringParseUint32` or
+ * `StringParseHexUint16`. Values can be separated by any run of whitespace and/or comma (',') characters, and the list
+ * can start or end with separators. Parsing stops at the end of the string (null character).
+ *
+ * On success @p aString is updated to point to the null character at the end of the string. On failure, @p aString
+ * remains unchanged and @p aValues may be partially updated.
+ *
+ * @tparam Type   The value type.
+ *
+ * @param[in,out] aString      A reference to a pointer to string to parse.
+ * @param[in]     aParser      The function to parse a single value.
+ * @param[out]    aValues      A pointer to an array to output the parsed values.
+ * @param[in]     aMaxValues   The maximum number of values that can be stored in @p aValues.
+ * @param[out]    aNumValues   A reference to return the number of parsed values.
+ *
+ * @retval kErrorNone    Successfully parsed all the numbers in the list. @p aValues and @p aNumValues are updated.
+ * @retval kErrorParse   Failed to parse a value from the list, or value is not followed by a separator.
+ * @retval kErrorNoBufs  The list contains more than @p aMaxValues values.
+ */
+template <typename Type>
+Error StringParseList(const char *&aString,
+                      Error (&aParser)(const char *&aString, Type &aValue),
+                      Type     *aValues,
+                      uint16_t  aMaxValues,
+                      uint16_t &aNumValues)
+{
+    Error       error = kErrorNone;
+    const char *cur   = aString;
+    uint16_t    count = 0;
+
+    while (true)
+    {
+        while (IsWhitespace(*cur) || (*cur == ','))
+        {
+            cur++;
+        }
+
+        if (*cur == kNullChar)
+        {
+            break;
+        }
+
+        VerifyOrExit(count < aMaxValues, error = kErrorNoBufs);
+        SuccessOrExit(error = aParser(cur, aValues[count]));
+        count++;
+
+        VerifyOrExit((*cur == kNullChar) || IsWhitespace(*cur) || (*cur == ','), error = kErrorParse);
+    }
+
+    aString    = cur;
+    aNumValues = count;
+
+exit:
+    return error;
+}
+
 /**
  * Converts all uppercase letter characters in a given string to lowercase.
  *
@@ -230,6 +686,28 @@ void StringConvertToLowercase(char *aString);
  */
 void StringConvertToUppercase(char *aString);
 
+/**
+ * Converts all uppercase letter characters in a given sequence of characters to lowercase.
+ *
+ * The characters are not required to be null-terminated. Unlike `StringConvertToLowercase(char *)`, the string length
+ * is not scanned first.
+ *
+ * @param[in,out] aString   A pointer to the characters to convert.
+ * @param[in]     aLength   The number of characters to convert.
+ */
+void StringConvertToLowercase(char *aString, uint16_t aLength);
+
+/**
+ * Converts all lowercase letter characters in a given sequence of characters to uppercase.
+ *
+ * The characters are not required to be null-terminated. Unlike `StringConvertToUppercase(char *)`, the string length
+ * is not scanned first.
+ *
+ * @param[in,out] aString   A pointer to the characters to convert.
+ * @param[in]     aLength   The number of characters to convert.
+ */
+void StringConvertToUppercase(char *aString, uint16_t aLength);
+
 /**
  * Converts an uppercase letter character to lowercase.
  *
@@ -336,6 +814,17 @@ bool IsValidUtf8String(const char *aString);
  */
 bool IsValidUtf8String(const char *aString, size_t aLength);
 
+/**
+ * Validates whether a given string view follows UTF-8 encoding.
+ * Control characters are not allowed.
+ *
+ * @param[in]  aString  The string view.
+ *
+ * @retval TRUE   The sequence is a valid UTF-8 string.
+ * @retval FALSE  The sequence is not a valid UTF-8 string.
+ */
+bool IsValidUtf8String(const StringView &aString);
+
 /**
  * This `constexpr` function checks whether two given C strings are in order (alphabetical order).
  *
@@ -422,6 +911,17 @@ public:
      */
     StringWriter &AppendVarArgs(const char *aFormat, va_list aArgs);
 
+    /**
+     * Appends the characters of a string view to the buffer.
+     *
+     * The characters are copied as they are (they are not interpreted as a format string).
+     *
+     * @param[in] aString    The string view to append.
+     *
+     * @returns The string writer.
+     */
+    StringWriter &Append(const StringView &aString);
+
     /**
      * Appends an array of bytes in hex representation (using "%02x" style) to the buffer.
      *
@@ -432,6 +932,52 @@ public:
      */
     StringWriter &AppendHexBytes(const uint8_t *aBytes, uint16_t aLength);
 
+    /**
+     * Appends the shortest representation of a `double` value which converts back to the same value.
+     *
+     * Does not use the libc `printf()` floating-point support. See `FloatFormatter::AppendShortest()` for the format.
+     *
+     * @param[in] aValue    The value to append.
+     *
+     * @returns The string writer.
+     */
+    StringWriter &AppendDouble(double aValue);
+
+    /**
+     * Appends a `double` value in decimal notation with a given number of fractional digits.
+     *
+     * Does not use the libc `printf()` floating-point support. See `FloatFormatter::AppendFixed()` for the format.
+     *
+     * @param[in] aValue       The value to append.
+     * @param[in] aPrecision   The number of fractional digits.
+     *
+     * @returns The string writer.
+     */
+    StringWriter &AppendDouble(double aValue, uint8_t aPrecision);
+
+    /**
+     * Appends the shortest representation of a `float` value which converts back to the same value.
+     *
+     * Does not use the libc `printf()` floating-point support. See `FloatFormatter::AppendShortest()` for the format.
+     *
+     * @param[in] aValue    The value to append.
+     *
+     * @returns The string writer.
+     */
+    StringWriter &AppendFloat(float aValue);
+
+    /**
+     * Appends a `float` value in decimal notation with a given number of fractional digits.
+     *
+     * Does not use the libc `printf()` floating-point support. See `FloatFormatter::AppendFixed()` for the format.
+     *
+     * @param[in] aValue       The value to append.
+     * @param[in] aPrecision   The number of fractional digits.
+     *
+     * @returns The string writer.
+     */
+    StringWriter &AppendFloat(float aValue, uint8_t aPrecision);
+
     /**
      * Appends a given character a given number of times.
      *
@@ -443,14 +989,26 @@ public:
     /**
      * Converts all uppercase letter characters in the string to lowercase.
      */
-    void ConvertToLowercase(void) { StringConvertToLowercase(mBuffer); }
+    void ConvertToLowercase(void) { StringConvertToLowercase(mBuffer, GetBufferedLength()); }
 
     /**
      * Converts all lowercase letter characters in the string to uppercase.
      */
-    void ConvertToUppercase(void) { StringConvertToUppercase(mBuffer); }
+    void ConvertToUppercase(void) { StringConvertToUppercase(mBuffer, GetBufferedLength()); }
+
+protected:
+    /**
+     * Copies the content (and length) of another string writer into the string writer.
+     *
+     * If the content of @p aOther does not fit in the buffer, it is truncated.
+     *
+     * @param[in] aOther  The string writer to copy from.
+     */
+    void CopyFrom(const StringWriter &aOther);
 
 private:
+    uint16_t GetBufferedLength(void) const { return IsTruncated() ? static_cast<uint16_t>(mSize - 1) : mLength; }
+
     char          *mBuffer;
     uint16_t       mLength;
     const uint16_t mSize;
@@ -472,6 +1030,34 @@ public:
     {
     }
 
+    /**
+     * Initializes the string by copying another string.
+     *
+     * @param[in] aOther  The string to copy from.
+     */
+    String(const String &aOther)
+        : StringWriter(mBuffer, sizeof(mBuffer))
+    {
+        CopyFrom(aOther);
+    }
+
+    /**
+     * Overloads assignment `=` operator to copy another string into the string.
+     *
+     * @param[in] aOther  The string to copy from.
+     *
+     * @returns A reference to the string.
+     */
+    String &operator=(const String &aOther)
+    {
+        if (&aOther != this)
+        {
+            CopyFrom(aOther);
+        }
+
+        return *this;
+    }
+
     /**
      * Returns the string as a null-terminated C string.
      *
@@ -483,9 +1069,134 @@ private:
     char mBuffer[kSize];
 };
 
+/**
+ * Implements writing to a string buffer which is flushed to a callback whenever it fills up.
+ *
+ * Unlike `StringWriter`, the output is never truncated. When the buffer is full its content is passed (as a chunk) to
+ * the flush handler and writing continues from the start of the buffer. This allows large outputs (e.g., table dumps)
+ * to be streamed through a small buffer (e.g., on stack) without using heap.
+ *
+ * A formatted `Append()` whose output does not fit in the whole buffer is broken into its individual conversion
+ * specifications, with string arguments (`%s`) streamed in chunks. A single non-string conversion (e.g., a number
+ * along with its field width) must fit in the buffer, otherwise it is truncated.
+ *
+ * The content of the buffer is kept null-terminated, so every chunk passed to the flush handler is also a valid C
+ * string. Any remaining content must be explicitly flushed using `Flush()`.
+ */
+class StreamingStringWriter
+{
+public:
+    /**
+     * Represents the flush handler callback.
+     *
+     * @param[in] aChunk    A pointer to the chunk of characters (null-terminated).
+     * @param[in] aLength   The length of @p aChunk (excluding the null character).
+     * @param[in] aContext  The arbitrary context provided when the writer was initialized.
+     */
+    typedef void (*FlushHandler)(const char *aChunk, uint16_t aLength, void *aContext);
+
+    /**
+     * Initializes the object as cleared on the provided buffer.
+     *
+     * @param[in] aBuffer   A pointer to the char buffer to write into.
+     * @param[in] aSize     The size of @p aBuffer (MUST be at least 2).
+     * @param[in] aHandler  The flush handler.
+     * @param[in] aContext  An arbitrary context passed to @p aHandler.
+     */
+    StreamingStringWriter(char *aBuffer, uint16_t aSize, FlushHandler aHandler, void *aContext);
+
+    /**
+     * Gets the length of the content currently in the buffer (not yet flushed).
+     *
+     * @returns The buffered string length.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * Gets the total length of the output written so far (flushed and buffered).
+     *
+     * @returns The total output length.
+     */
+    uint32_t GetTotalLength(void) const { return mFlushedLength + mLength; }
+
+    /**
+     * Appends `printf()` style formatted data.
+     *
+     * @param[in] aFormat    A pointer to the format string.
+     * @param[in] ...        Arguments for the format specification.
+     *
+     * @returns The string writer.
+     */
+    StreamingStringWriter &Append(const char *aFormat, ...) TY_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 3);
+
+    /**
+     * Appends `printf()` style formatted data.
+     *
+     * @param[in] aFormat    A pointer to the format string.
+     * @param[in] aArgs      Arguments for the format specification (as `va_list`).
+     *
+     * @returns The string writer.
+     */
+    StreamingStringWriter &AppendVarArgs(const char *aFormat, va_list aArgs);
+
+    /**
+     * Appends the characters of a string view.
+     *
+     * The characters are copied as they are (they are not interpreted as a format string).
+     *
+     * @param[in] aString    The string view to append.
+     *
+     * @returns The string writer.
+     */
+    StreamingStringWriter &Append(const StringView &aString);
+
+    /**
+     * Appends an array of bytes in hex representation (using "%02x" style).
+     *
+     * @param[in] aBytes    A pointer to buffer containing the bytes to append.
+     * @param[in] aLength   The length of @p aBytes buffer (in bytes).
+     *
+     * @returns The string writer.
+     */
+    StreamingStringWriter &AppendHexBytes(const uint8_t *aBytes, uint16_t aLength);
+
+    /**
+     * Appends a given character a given number of times.
+     *
+     * @param[in] aChar    The character to append.
+     * @param[in] aCount   Number of times to append @p aChar.
+     *
+     * @returns The string writer.
+     */
+    StreamingStringWriter &AppendCharMultipleTimes(char aChar, uint16_t aCount);
+
+    /**
+     * Flushes the buffered content (if any) to the flush handler.
+     *
+     * @returns The string writer.
+     */
+    StreamingStringWriter &Flush(void);
+
+private:
+    static constexpr uint16_t kMaxSpecSize = 32;
+
+    uint16_t GetAvailable(void) const { return static_cast<uint16_t>(mSize - 1 - mLength); }
+    bool     TryAppend(const char *aFormat, va_list aArgs);
+    void     AppendConversion(const char *aSpec, ...);
+    void     AppendConversions(const char *aFormat, va_list aArgs);
+    void     AppendPadded(const char *aString, int aPrecision, int aWidth, bool aLeftAlign);
+
+    char          *mBuffer;
+    uint16_t       mLength;
+    const uint16_t mSize;
+    uint32_t       mFlushedLength;
+    FlushHandler   mHandler;
+    void          *mContext;
+};
+
 /**
  * Provides helper methods to convert from a set of `uint16_t` values (e.g., a non-sequential `enum`) to
- * string using binary search in a lookup table.
+ * string using a lookup table.
  */
 class Stringify : public BinarySearch
 {
@@ -511,8 +1222,10 @@ public:
     };
 
     /**
-     * Looks up a key in a given sorted table array (using binary search) and return the associated
-     * strings with the key.
+     * Looks up a key in a given sorted table array and return the associated strings with the key.
+     *
+     * If the keys in the table are dense (consecutive values) the entry is directly indexed, otherwise binary search
+     * is used. Since the table is sorted, checking whether it is dense only requires comparing its first and last keys.
      *
      * @note This method requires the array to be sorted, otherwise its behavior is undefined.
      *
@@ -527,12 +1240,228 @@ public:
     template <uint16_t kLength>
     static const char *Lookup(uint16_t aKey, const Entry (&aTable)[kLength], const char *aNotFound = "unknown")
     {
-        const Entry *entry = BinarySearch::Find(aKey, aTable);
+        const Entry *entry;
+
+        if (aTable[kLength - 1].mKey - aTable[0].mKey == kLength - 1)
+        {
+            uint16_t index = static_cast<uint16_t>(aKey - aTable[0].mKey);
+
+            entry = (index < kLength) ? &aTable[index] : nullptr;
+        }
+        else
+        {
+            entry = BinarySearch::Find(aKey, aTable);
+        }
 
         return (entry != nullptr) ? entry->mString : aNotFound;
     }
 
+    /**
+     * Looks up a key in a given `constexpr` sorted table array and return the associated strings with the key.
+     *
+     * The lookup method is selected at compile time based on the keys in @p kTable:
+     *
+     * - If the keys are dense (consecutive values), the entry is directly indexed.
+     * - Otherwise a minimal perfect hash of the keys is built at compile time and the entry is found using two hash
+     *   calculations and a single key comparison.
+     * - If no perfect hash can be found (which is unlikely), binary search is used.
+     *
+     * It is also verified at compile time (`static_assert`) that @p kTable is sorted.
+     *
+     * Example of use:
+     *
+     *     static constexpr Stringify::Entry kStateStrings[] = { {kStateA, "A"}, {kStateC, "C"}, {kStateZ, "Z"} };
+     *
+     *     return Stringify::Lookup<kStateStrings>(aState);
+     *
+     * @tparam kTable  A reference to a `constexpr` array of `Entry` with static storage duration.
+     *
+     * @param[in] aKey       The key to search for within the table.
+     * @param[in] aNotFound  A C string to return if @p aKey was not found in the table.
+     *
+     * @returns The associated string with @p aKey in @p kTable if found, or @p aNotFound otherwise.
+     */
+    template <const auto &kTable> static const char *Lookup(uint16_t aKey, const char *aNotFound = "unknown")
+    {
+        return Table<kTable>::Lookup(aKey, aNotFound);
+    }
+
     Stringify(void) = delete;
+
+private:
+    static constexpr uint16_t kMaxPerfectHashSeed = 0x2000; // Max seed to try per bucket when building perfect hash.
+
+    template <uint16_t kLength> static constexpr uint16_t LengthOf(const Entry (&)[kLength]) { return kLength; }
+
+    static constexpr uint16_t Hash(uint16_t aKey, uint16_t aSeed, uint16_t aRange)
+    {
+        // Mixes the key and seed and maps the result to `[0, aRange)`
+        // using multiply-shift.
+
+        uint32_t hash = HashUint32(static_cast<uint32_t>(aKey) | (static_cast<uint32_t>(aSeed) << 16));
+
+        return static_cast<uint16_t>((static_cast<uint64_t>(hash) * aRange) >> 32);
+    }
+
+    template <uint16_t kLength, uint16_t kNumBuckets> struct PerfectHash
+    {
+        // Minimal perfect hash using "hash and displace". Keys are
+        // first hashed (with seed zero) into `kNumBuckets` buckets.
+        // Every bucket then has its own seed such that all the keys
+        // in the table hash to distinct slots in `[0, kLength)`.
+        // `mSlots` gives the index of the table entry in each slot.
+
+        bool     mIsValid;
+        uint16_t mSeeds[kNumBuckets];
+        uint16_t mSlots[kLength];
+    };
+
+    template <uint16_t kLength, uint16_t kNumBuckets>
+    static constexpr PerfectHash<kLength, kNumBuckets> BuildPerfectHash(const Entry (&aTable)[kLength])
+    {
+        PerfectHash<kLength, kNumBuckets> perfectHash{};
+        uint16_t                          bucketStarts[kNumBuckets + 1] = {};
+        uint16_t                          members[kLength]              = {};
+        uint16_t                          order[kNumBuckets]            = {};
+        bool                              isSlotUsed[kLength]           = {};
+
+        // Group the entry indexes by bucket (counting sort), so that
+        // `members[bucketStarts[b]..bucketStarts[b + 1]]` gives the
+        // entries in bucket `b`.
+
+        for (const Entry &entry : aTable)
+        {
+            bucketStarts[Hash(entry.mKey, 0, kNumBuckets) + 1]++;
+        }
+
+        for (uint16_t bucket = 0; bucket < kNumBuckets; bucket++)
+        {
+            bucketStarts[bucket + 1] += bucketStarts[bucket];
+        }
+
+        for (uint16_t index = 0; index < kLength; index++)
+        {
+            uint16_t bucket   = Hash(aTable[index].mKey, 0, kNumBuckets);
+            uint16_t position = bucketStarts[bucket];
+
+            while (members[position] != 0)
+            {
+                position++;
+            }
+
+            // Indexes are stored plus one so zero marks an unused position.
+            members[position] = index + 1;
+        }
+
+        // Place the buckets in order of decreasing size, larger
+        // buckets are harder to place so they go first.
+
+        for (uint16_t bucket = 0; bucket < kNumBuckets; bucket++)
+        {
+            uint16_t size = bucketStarts[bucket + 1] - bucketStarts[bucket];
+            uint16_t pos  = bucket;
+
+            for (; (pos > 0) && (bucketStarts[order[pos - 1] + 1] - bucketStarts[order[pos - 1]] < size); pos--)
+            {
+                order[pos] = order[pos - 1];
+            }
+
+            order[pos] = bucket;
+        }
+
+        perfectHash.mIsValid = true;
+
+        for (uint16_t bucket : order)
+        {
+            uint16_t start    = bucketStarts[bucket];
+            uint16_t end      = bucketStarts[bucket + 1];
+            bool     isPlaced = (start == end);
+
+            for (uint16_t seed = 1; !isPlaced && (seed <= kMaxPerfectHashSeed); seed++)
+            {
+                isPlaced = true;
+
+                for (uint16_t i = start; isPlaced && (i < end); i++)
+                {
+                    uint16_t slot = Hash(aTable[members[i] - 1].mKey, seed, kLength);
+
+                    isPlaced = !isSlotUsed[slot];
+
+                    for (uint16_t j = start; isPlaced && (j < i); j++)
+                    {
+                        isPlaced = (slot != Hash(aTable[members[j] - 1].mKey, seed, kLength));
+                    }
+                }
+
+                if (isPlaced)
+                {
+                    perfectHash.mSeeds[bucket] = seed;
+
+                    for (uint16_t i = start; i < end; i++)
+                    {
+                        uint16_t slot = Hash(aTable[members[i] - 1].mKey, seed, kLength);
+
+                        isSlotUsed[slot]         = true;
+                        perfectHash.mSlots[slot] = members[i] - 1;
+                    }
+                }
+            }
+
+            if (!isPlaced)
+            {
+                perfectHash.mIsValid = false;
+                break;
+            }
+        }
+
+        return perfectHash;
+    }
+
+    template <const auto &kTable> class Table
+    {
+    public:
+        static const char *Lookup(uint16_t aKey, const char *aNotFound)
+        {
+            const Entry *entry = nullptr;
+
+            if constexpr (kIsDense)
+            {
+                uint16_t index = static_cast<uint16_t>(aKey - kTable[0].mKey);
+
+                if (index < kLength)
+                {
+                    entry = &kTable[index];
+                }
+            }
+            else if constexpr (kPerfectHash.mIsValid)
+            {
+                uint16_t bucket = Hash(aKey, 0, kNumBuckets);
+
+                entry = &kTable[kPerfectHash.mSlots[Hash(aKey, kPerfectHash.mSeeds[bucket], kLength)]];
+
+                if (entry->mKey != aKey)
+                {
+                    entry = nullptr;
+                }
+            }
+            else
+            {
+                entry = BinarySearch::Find(aKey, kTable);
+            }
+
+            return (entry != nullptr) ? entry->mString : aNotFound;
+        }
+
+    private:
+        static constexpr uint16_t kLength     = LengthOf(kTable);
+        static constexpr uint16_t kNumBuckets = (kLength + 1) / 2;
+        static constexpr bool     kIsDense    = (kTable[kLength - 1].mKey - kTable[0].mKey == kLength - 1);
+
+        static_assert(BinarySearch::IsSorted(kTable), "Stringify table is not sorted");
+
+        static constexpr PerfectHash<kLength, kNumBuckets> kPerfectHash =
+            kIsDense ? PerfectHash<kLength, kNumBuckets>{} : BuildPerfectHash<kLength, kNumBuckets>(kTable);
+    };
 };
 
 /**
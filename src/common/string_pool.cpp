@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the pool of interned strings.
+ */
+
+#include "string_pool.hpp"
+
+#include <string.h>
+
+#include "ty/common/code_utils.hpp"
+
+namespace ty {
+
+StringPool::StringPool(Entry *aEntries, uint16_t aMaxStrings, char *aStorage, uint16_t aStorageSize)
+    : mEntries(aEntries)
+    , mStorage(aStorage)
+    , mMaxStrings(aMaxStrings)
+    , mNumStrings(0)
+    , mStorageSize(aStorageSize)
+    , mStorageLength(0)
+{
+}
+
+void StringPool::Clear(void)
+{
+    mNumStrings    = 0;
+    mStorageLength = 0;
+}
+
+Error StringPool::Intern(const StringView &aString, StringId &aId)
+{
+    Error    error  = kErrorNone;
+    StringId id     = GetId(aString);
+    uint16_t index  = FindIndex(id);
+    uint16_t length = aString.GetLength();
+
+    if ((index < mNumStrings) && (mEntries[index].mId == id))
+    {
+        VerifyOrExit(StringMatch(GetString(mEntries[index]), aString), error = kErrorFailed);
+        ExitNow();
+    }
+
+    VerifyOrExit(mNumStrings < mMaxStrings, error = kErrorNoBufs);
+    VerifyOrExit(length < mStorageSize - mStorageLength, error = kErrorNoBufs);
+
+    memmove(&mEntries[index + 1], &mEntries[index], (mNumStrings - index) * sizeof(Entry));
+    mEntries[index].mId     = id;
+    mEntries[index].mOffset = mStorageLength;
+    mNumStrings++;
+
+    memcpy(&mStorage[mStorageLength], aString.GetString(), length);
+    mStorage[mStorageLength + length] = kNullChar;
+    mStorageLength += static_cast<uint16_t>(length + 1);
+
+exit:
+    if (error == kErrorNone)
+    {
+        aId = id;
+    }
+
+    return error;
+}
+
+StringId StringPool::Find(const StringView &aString) const
+{
+    StringId id    = GetId(aString);
+    uint16_t index = FindIndex(id);
+
+    if ((index >= mNumStrings) || (mEntries[index].mId != id) || !StringMatch(GetString(mEntries[index]), aString))
+    {
+        id = kInvalidStringId;
+    }
+
+    return id;
+}
+
+const char *StringPool::GetString(StringId aId) const
+{
+    uint16_t    index  = FindIndex(aId);
+    const char *string = nullptr;
+
+    if ((index < mNumStrings) && (mEntries[index].mId == aId))
+    {
+        string = GetString(mEntries[index]);
+    }
+
+    return string;
+}
+
+uint16_t StringPool::FindIndex(StringId aId) const
+{
+    // Returns the index of the first entry whose id is not less
+    // than `aId` (the index where an entry with `aId` is or would
+    // be inserted).
+
+    uint16_t left  = 0;
+    uint16_t right = mNumStrings;
+
+    while (left < right)
+    {
+        uint16_t middle = static_cast<uint16_t>((left + right) / 2);
+
+        if (mEntries[middle].mId < aId)
+        {
+            left = static_cast<uint16_t>(middle + 1);
+        }
+        else
+        {
+            right = middle;
+        }
+    }
+
+    return left;
+}
+
+} // namespace ty
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for a pool of interned strings.
+ */
+
+#ifndef STRING_POOL_HPP_
+#define STRING_POOL_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stdint.h>
+
+#include "common/string.hpp"
+#include "ty/common/error.hpp"
+#include "ty/common/hash.hpp"
+#include "ty/common/non_copyable.hpp"
+
+namespace ty {
+
+/**
+ * Represents the id of an interned string.
+ */
+typedef uint32_t StringId;
+
+static constexpr StringId kInvalidStringId = 0; ///< Invalid (unknown) string id.
+
+/**
+ * Implements a pool of interned strings, mapping strings to stable 32-bit ids.
+ *
+ * The id of a string is its 32-bit FNV-1a hash. It is therefore determined only by the string content: the same
+ * string gets the same id on every run and every device, and the id of a string literal can be calculated at compile
+ * time using `StringPool::GetId()`. This allows the ids to be used in place of the strings (e.g., in binary log or
+ * trace formats), and allows lookups to compare ids instead of strings.
+ *
+ * A copy of each interned string is kept in the pool storage. The entries are kept sorted by id, so finding a string
+ * from its id uses binary search. If two different strings hash to the same id, the second one is rejected when it is
+ * interned.
+ *
+ * `StringPool` does not own the entry and storage buffers, which are provided by the caller. `StaticStringPool` can be
+ * used to define a pool along with its buffers.
+ *
+ * @note `StringPool` is not thread-safe.
+ */
+class StringPool : private NonCopyable
+{
+public:
+    /**
+     * Represents an entry in the pool (an interned string).
+     *
+     * Is used by `StaticStringPool` to define the entry buffer and MUST be treated as opaque.
+     */
+    struct Entry
+    {
+        StringId mId;     ///< The string id.
+        uint16_t mOffset; ///< The offset of the string in the storage buffer.
+    };
+
+    /**
+     * Calculates the id of a given null-terminated string.
+     *
+     * Is `constexpr` so it can be used to get the id of a string literal at compile time.
+     *
+     * @param[in] aString  A pointer to the null-terminated string.
+     *
+     * @returns The id of @p aString.
+     */
+    static constexpr StringId GetId(const char *aString) { return ToId(Fnv1a32(aString)); }
+
+    /**
+     * Calculates the id of a given string view.
+     *
+     * @param[in] aString  The string view.
+     *
+     * @returns The id of @p aString.
+     */
+    static StringId GetId(const StringView &aString)
+    {
+        return ToId(Fnv1a32(aString.GetString(), aString.GetLength()));
+    }
+
+    /**
+     * Initializes the pool on the provided buffers.
+     *
+     * @param[in] aEntries      A pointer to an array of entries.
+     * @param[in] aMaxStrings   The number of entries in @p aEntries (maximum number of strings).
+     * @param[in] aStorage      A pointer to a buffer to store the strings.
+     * @param[in] aStorageSize  The size of @p aStorage (in bytes).
+     */
+    StringPool(Entry *aEntries, uint16_t aMaxStrings, char *aStorage, uint16_t aStorageSize);
+
+    /**
+     * Removes all interned strings from the pool.
+     */
+    void Clear(void);
+
+    /**
+     * Gets the number of interned strings in the pool.
+     *
+     * @returns The number of interned strings.
+     */
+    uint16_t GetNumStrings(void) const { return mNumStrings; }
+
+    /**
+     * Interns a given string in the pool.
+     *
+     * If the string is already in the pool, its existing id is returned and the pool is not changed.
+     *
+     * @param[in]  aString  The string to intern.
+     * @param[out] aId      A reference to output the id of @p aString.
+     *
+     * @retval kErrorNone     Successfully interned the string, @p aId is updated.
+     * @retval kErrorNoBufs   There are no free entries or not enough storage space left in the pool.
+     * @retval kErrorFailed   A different string with the same id is already in the pool.
+     */
+    Error Intern(const StringView &aString, StringId &aId);
+
+    /**
+     * Finds the id of a given string in the pool.
+     *
+     * @param[in] aString  The string to find.
+     *
+     * @returns The id of @p aString, or `kInvalidStringId` if it is not in the pool.
+     */
+    StringId Find(const StringView &aString) const;
+
+    /**
+     * Gets the interned string associated with a given id.
+     *
+     * @param[in] aId  The string id.
+     *
+     * @returns A pointer to the null-terminated interned string, or `nullptr` if @p aId is not in the pool.
+     */
+    const char *GetString(StringId aId) const;
+
+private:
+    static constexpr StringId ToId(uint32_t aHash) { return (aHash != kInvalidStringId) ? aHash : ~kInvalidStringId; }
+
+    uint16_t    FindIndex(StringId aId) const;
+    const char *GetString(const Entry &aEntry) const { return &mStorage[aEntry.mOffset]; }
+
+    Entry   *mEntries;
+    char    *mStorage;
+    uint16_t mMaxStrings;
+    uint16_t mNumStrings;
+    uint16_t mStorageSize;
+    uint16_t mStorageLength;
+};
+
+/**
+ * Defines a `StringPool` along with its entry and storage buffers.
+ *
+ * @tparam kMaxStrings   The maximum number of strings in the pool.
+ * @tparam kStorageSize  The size of the storage buffer (in bytes). Each string uses its length plus one (for its null
+ *                       character).
+ */
+template <uint16_t kMaxStrings, uint16_t kStorageSize> class StaticStringPool : public StringPool
+{
+    static_assert(kMaxStrings > 0, "StringPool cannot be empty");
+
+public:
+    /**
+     * Initializes the pool as empty.
+     */
+    StaticStringPool(void)
+        : StringPool(mEntries, kMaxStrings, mStorage, kStorageSize)
+    {
+    }
+
+private:
+    Entry mEntries[kMaxStrings];
+    char  mStorage[kStorageSize];
+};
+
+} // namespace ty
+
+#endif // STRING_POOL_HPP_
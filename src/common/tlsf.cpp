@@ -0,0 +1,463 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the TLSF (two-level segregated fit) memory allocator.
+ */
+
+#include "tlsf.hpp"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "ty/common/code_utils.hpp"
+#include "ty/common/const_cast.hpp"
+#include "ty/common/num_utils.hpp"
+
+namespace ty {
+
+// Each block starts with a header holding the size of its payload
+// (a multiple of 8) and flags, and the payload size of the previous
+// block (to find it when merging). The payload of a free block holds
+// its links in its free list. The region ends with a zero-size used
+// block, so that the last block always has a next block.
+
+struct Tlsf::Block
+{
+    static constexpr uint32_t kFlagFree     = 1 << 0;
+    static constexpr uint32_t kFlagPrevFree = 1 << 1;
+    static constexpr uint32_t kFlagsMask    = kFlagFree | kFlagPrevFree;
+
+    uint32_t GetSize(void) const { return mSizeAndFlags & ~kFlagsMask; }
+    bool     IsFree(void) const { return (mSizeAndFlags & kFlagFree) != 0; }
+    bool     IsPrevFree(void) const { return (mSizeAndFlags & kFlagPrevFree) != 0; }
+    uint8_t *GetPayload(void) { return reinterpret_cast<uint8_t *>(this) + kHeaderSize; }
+    Block   *GetNext(void) { return reinterpret_cast<Block *>(GetPayload() + GetSize()); }
+
+    Block *GetPrev(void)
+    {
+        return reinterpret_cast<Block *>(reinterpret_cast<uint8_t *>(this) - kHeaderSize - mPrevSize);
+    }
+
+    void SetFlag(uint32_t aFlag, bool aValue)
+    {
+        mSizeAndFlags = aValue ? (mSizeAndFlags | aFlag) : (mSizeAndFlags & ~aFlag);
+    }
+
+    void SetSize(uint32_t aSize)
+    {
+        mSizeAndFlags = aSize | (mSizeAndFlags & kFlagsMask);
+        GetNext()->mPrevSize = aSize;
+    }
+
+    void SetFree(bool aFree)
+    {
+        SetFlag(kFlagFree, aFree);
+        GetNext()->SetFlag(kFlagPrevFree, aFree);
+    }
+
+    static Block *FromPayload(void *aPayload)
+    {
+        return reinterpret_cast<Block *>(static_cast<uint8_t *>(aPayload) - kHeaderSize);
+    }
+
+    static constexpr uint32_t kHeaderSize = kBlockHeaderSize;
+    static constexpr uint32_t kMinPayload = kMinPayloadSize;
+
+    uint32_t mPrevSize;
+    uint32_t mSizeAndFlags;
+    Block   *mNextFree; // Only valid in a free block.
+    Block   *mPrevFree; // Only valid in a free block.
+};
+
+static constexpr uint32_t kHeaderSize  = Tlsf::Block::kHeaderSize;
+static constexpr uint32_t kMinPayload  = Tlsf::Block::kMinPayload;
+static constexpr uint32_t kMaxAllocate = 0x80000000;
+
+static_assert(offsetof(Tlsf::Block, mNextFree) == kHeaderSize, "Block header size is not 8 bytes");
+
+Tlsf::Tlsf(Block **aFreeLists, uint32_t *aSlBitmaps, uint8_t aFlCount, void *aRegion, size_t aRegionSize)
+    : mFreeLists(aFreeLists)
+    , mSlBitmaps(aSlBitmaps)
+    , mFlBitmap(0)
+    , mFlCount(Min<uint8_t>(aFlCount, 32))
+    , mTotalSize(0)
+    , mFreeSize(0)
+    , mUsedSize(0)
+    , mMaxUsedSize(0)
+    , mNumFreeBlocks(0)
+    , mNumUsedBlocks(0)
+{
+    uintptr_t start   = reinterpret_cast<uintptr_t>(aRegion);
+    uintptr_t end     = (start + aRegionSize) & ~static_cast<uintptr_t>(kAlignSize - 1);
+    size_t    maxSize = 0xfffffff8;
+    Block    *first;
+    Block    *sentinel;
+    size_t    size;
+
+    memset(mFreeLists, 0, sizeof(Block *) * mFlCount * kSlCount);
+    memset(mSlBitmaps, 0, sizeof(uint32_t) * mFlCount);
+
+    start = (start + kAlignSize - 1) & ~static_cast<uintptr_t>(kAlignSize - 1);
+    VerifyOrExit((end > start) && (end - start >= 2 * kHeaderSize + kMinPayload));
+
+    // The largest block that the first-level lists can hold is smaller
+    // than `1 << (mFlCount + kFlShift - 1)`.
+    if (mFlCount + kFlShift - 1 < 32)
+    {
+        maxSize = (static_cast<size_t>(1) << (mFlCount + kFlShift - 1)) - kAlignSize;
+    }
+
+    size = Min<size_t>(end - start - 2 * kHeaderSize, maxSize);
+
+    first    = reinterpret_cast<Block *>(start);
+    sentinel = reinterpret_cast<Block *>(first->GetPayload() + size);
+
+    first->mPrevSize        = 0;
+    first->mSizeAndFlags    = 0;
+    sentinel->mSizeAndFlags = 0;
+    first->SetSize(static_cast<uint32_t>(size));
+
+    mTotalSize = static_cast<uint32_t>(size);
+    InsertFreeBlock(*first);
+
+exit:
+    return;
+}
+
+void *Tlsf::Allocate(size_t aSize)
+{
+    uint8_t *payload = nullptr;
+    uint32_t size;
+    Block   *block;
+
+    VerifyOrExit(AdjustSize(aSize, size));
+
+    block = FindFreeBlock(size);
+    VerifyOrExit(block != nullptr);
+
+    RemoveFreeBlock(*block);
+    SplitUsedBlock(*block, size);
+    MarkUsed(*block);
+
+    payload = block->GetPayload();
+
+exit:
+    return payload;
+}
+
+void *Tlsf::CAlloc(size_t aCount, size_t aSize)
+{
+    void *pointer = nullptr;
+
+    VerifyOrExit((aSize == 0) || (aCount <= kMaxAllocate / aSize));
+
+    pointer = Allocate(aCount * aSize);
+    VerifyOrExit(pointer != nullptr);
+    memset(pointer, 0, aCount * aSize);
+
+exit:
+    return pointer;
+}
+
+void *Tlsf::Reallocate(void *aPointer, size_t aSize)
+{
+    void    *pointer = nullptr;
+    uint32_t size;
+    uint32_t oldSize;
+    Block   *block;
+    Block   *next;
+
+    if (aPointer == nullptr)
+    {
+        ExitNow(pointer = Allocate(aSize));
+    }
+
+    if (aSize == 0)
+    {
+        Free(aPointer);
+        ExitNow();
+    }
+
+    VerifyOrExit(AdjustSize(aSize, size));
+
+    block   = Block::FromPayload(aPointer);
+    oldSize = block->GetSize();
+    next    = block->GetNext();
+
+    if (size <= oldSize)
+    {
+        mUsedSize -= oldSize;
+        SplitUsedBlock(*block, size);
+        mUsedSize += block->GetSize();
+        pointer = aPointer;
+    }
+    else if (next->IsFree() && (oldSize + kHeaderSize + next->GetSize() >= size))
+    {
+        // Grows in place by merging the next (free) block.
+        RemoveFreeBlock(*next);
+        block->SetSize(oldSize + kHeaderSize + next->GetSize());
+        SplitUsedBlock(*block, size);
+        mUsedSize += block->GetSize() - oldSize;
+        mMaxUsedSize = Max(mMaxUsedSize, mUsedSize);
+        pointer      = aPointer;
+    }
+    else
+    {
+        pointer = Allocate(aSize);
+        VerifyOrExit(pointer != nullptr);
+        memcpy(pointer, aPointer, oldSize);
+        Free(aPointer);
+    }
+
+exit:
+    return pointer;
+}
+
+void Tlsf::Free(void *aPointer)
+{
+    Block *block;
+
+    VerifyOrExit(aPointer != nullptr);
+
+    block = Block::FromPayload(aPointer);
+
+    mUsedSize -= block->GetSize();
+    mNumUsedBlocks--;
+
+    MarkFree(*block);
+
+exit:
+    return;
+}
+
+size_t Tlsf::GetAllocatedSize(const void *aPointer)
+{
+    return Block::FromPayload(AsNonConst(aPointer))->GetSize();
+}
+
+void Tlsf::GetStats(Stats &aStats) const
+{
+    uint32_t largest = 0;
+
+    if (mFlBitmap != 0)
+    {
+        uint8_t fl = static_cast<uint8_t>(31 - CountLeadingZeros(mFlBitmap));
+        uint8_t sl = static_cast<uint8_t>(31 - CountLeadingZeros(mSlBitmaps[fl]));
+
+        for (const Block *block = GetFreeList(fl, sl); block != nullptr; block = block->mNextFree)
+        {
+            largest = Max(largest, block->GetSize());
+        }
+    }
+
+    aStats.mTotalSize       = mTotalSize;
+    aStats.mFreeSize        = mFreeSize;
+    aStats.mUsedSize        = mUsedSize;
+    aStats.mMaxUsedSize     = mMaxUsedSize;
+    aStats.mLargestFreeSize = GetMaxAllocateSize(largest);
+    aStats.mNumFreeBlocks   = mNumFreeBlocks;
+    aStats.mNumUsedBlocks   = mNumUsedBlocks;
+    aStats.mFragmentation =
+        (mFreeSize == 0) ? 0 : static_cast<uint8_t>(100 - static_cast<uint64_t>(largest) * 100 / mFreeSize);
+}
+
+uint32_t Tlsf::GetMaxAllocateSize(uint32_t aBlockSize)
+{
+    // An allocation is served from a list of blocks at least as large
+    // as its size rounded up to the start of the next range (see
+    // `FindFreeBlock()`), so a block can only serve the sizes up to the
+    // start of its own range.
+
+    if (aBlockSize >= kSmallBlockSize)
+    {
+        aBlockSize &= ~((1u << (31 - CountLeadingZeros(aBlockSize) - kSlCountLog2)) - 1);
+    }
+
+    return aBlockSize;
+}
+
+void Tlsf::MapSize(uint32_t aSize, uint8_t &aFl, uint8_t &aSl)
+{
+    // The small sizes are all in the first level, one list per size.
+    // The larger sizes have a first level per power of two, and each
+    // power of two is split into `kSlCount` equal ranges.
+
+    if (aSize < kSmallBlockSize)
+    {
+        aFl = 0;
+        aSl = static_cast<uint8_t>(aSize >> kAlignSizeLog2);
+    }
+    else
+    {
+        uint8_t msb = static_cast<uint8_t>(31 - CountLeadingZeros(aSize));
+
+        aFl = static_cast<uint8_t>(msb - kFlShift + 1);
+        aSl = static_cast<uint8_t>((aSize >> (msb - kSlCountLog2)) ^ kSlCount);
+    }
+}
+
+bool Tlsf::AdjustSize(size_t aSize, uint32_t &aAdjustedSize)
+{
+    bool isValid = (aSize != 0) && (aSize <= kMaxAllocate);
+
+    if (isValid)
+    {
+        aAdjustedSize = Max(AlignUp(static_cast<uint32_t>(aSize)), kMinPayload);
+    }
+
+    return isValid;
+}
+
+Tlsf::Block *Tlsf::FindFreeBlock(uint32_t aSize)
+{
+    Block   *block = nullptr;
+    uint32_t slBitmap;
+    uint8_t  fl;
+    uint8_t  sl;
+
+    // Rounds the size up to the start of the next range, so that any
+    // block in the list found (or in a larger list) is large enough.
+    if (aSize >= kSmallBlockSize)
+    {
+        aSize += (1u << (31 - CountLeadingZeros(aSize) - kSlCountLog2)) - 1;
+    }
+
+    MapSize(aSize, fl, sl);
+    VerifyOrExit(fl < mFlCount);
+
+    slBitmap = mSlBitmaps[fl] & (~0u << sl);
+
+    if (slBitmap == 0)
+    {
+        uint32_t flBitmap = (fl + 1 < 32) ? (mFlBitmap & (~0u << (fl + 1))) : 0;
+
+        VerifyOrExit(flBitmap != 0);
+
+        fl       = CountTrailingZeros(flBitmap);
+        slBitmap = mSlBitmaps[fl];
+    }
+
+    sl    = CountTrailingZeros(slBitmap);
+    block = GetFreeList(fl, sl);
+
+exit:
+    return block;
+}
+
+void Tlsf::InsertFreeBlock(Block &aBlock)
+{
+    uint8_t fl;
+    uint8_t sl;
+    Block  *head;
+
+    MapSize(aBlock.GetSize(), fl, sl);
+    head = GetFreeList(fl, sl);
+
+    aBlock.mPrevFree = nullptr;
+    aBlock.mNextFree = head;
+
+    if (head != nullptr)
+    {
+        head->mPrevFree = &aBlock;
+    }
+
+    GetFreeList(fl, sl) = &aBlock;
+    mFlBitmap |= (1u << fl);
+    mSlBitmaps[fl] |= (1u << sl);
+
+    aBlock.SetFree(true);
+    mFreeSize += aBlock.GetSize();
+    mNumFreeBlocks++;
+}
+
+void Tlsf::RemoveFreeBlock(Block &aBlock)
+{
+    uint8_t fl;
+    uint8_t sl;
+
+    MapSize(aBlock.GetSize(), fl, sl);
+
+    if (aBlock.mPrevFree != nullptr)
+    {
+        aBlock.mPrevFree->mNextFree = aBlock.mNextFree;
+    }
+    else
+    {
+        GetFreeList(fl, sl) = aBlock.mNextFree;
+    }
+
+    if (aBlock.mNextFree != nullptr)
+    {
+        aBlock.mNextFree->mPrevFree = aBlock.mPrevFree;
+    }
+
+    if (GetFreeList(fl, sl) == nullptr)
+    {
+        mSlBitmaps[fl] &= ~(1u << sl);
+
+        if (mSlBitmaps[fl] == 0)
+        {
+            mFlBitmap &= ~(1u << fl);
+        }
+    }
+
+    aBlock.SetFree(false);
+    mFreeSize -= aBlock.GetSize();
+    mNumFreeBlocks--;
+}
+
+void Tlsf::MarkUsed(Block &aBlock)
+{
+    mUsedSize += aBlock.GetSize();
+    mMaxUsedSize = Max(mMaxUsedSize, mUsedSize);
+    mNumUsedBlocks++;
+}
+
+void Tlsf::MarkFree(Block &aBlock)
+{
+    // Merges the block with its free neighbors before inserting it.
+
+    Block *block = &aBlock;
+    Block *next  = block->GetNext();
+
+    if (next->IsFree())
+    {
+        RemoveFreeBlock(*next);
+        block->SetSize(block->GetSize() + kHeaderSize + next->GetSize());
+    }
+
+    if (block->IsPrevFree())
+    {
+        Block *prev = block->GetPrev();
+
+        RemoveFreeBlock(*prev);
+        prev->SetSize(prev->GetSize() + kHeaderSize + block->GetSize());
+        block = prev;
+    }
+
+    InsertFreeBlock(*block);
+}
+
+void Tlsf::SplitUsedBlock(Block &aBlock, uint32_t aSize)
+{
+    // Frees the end of the block if it is large enough for a block.
+
+    uint32_t size = aBlock.GetSize();
+    Block   *rest;
+
+    VerifyOrExit(size >= aSize + kHeaderSize + kMinPayload);
+
+    rest                = reinterpret_cast<Block *>(aBlock.GetPayload() + aSize);
+    rest->mSizeAndFlags = 0;
+    aBlock.SetSize(aSize);
+    rest->SetSize(size - aSize - kHeaderSize);
+
+    MarkFree(*rest);
+
+exit:
+    return;
+}
+
+} // namespace ty
@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for the TLSF (two-level segregated fit) memory allocator.
+ */
+
+#ifndef TLSF_HPP_
+#define TLSF_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ty/common/non_copyable.hpp"
+
+namespace ty {
+
+/**
+ * Implements a TLSF (two-level segregated fit) memory allocator over a given memory region.
+ *
+ * The free blocks are kept in segregated free lists: the first level splits the block sizes into power-of-two ranges,
+ * and the second level splits each range linearly into `kSlCount` sub-ranges. A bitmap per level records which lists
+ * are non-empty, so a free block large enough for a request is found with two bit-scans (see `CountTrailingZeros()`)
+ * instead of a search. Free blocks are merged with their free neighbors immediately, using the size of the previous
+ * block stored in each block header. Allocating, freeing and reallocating (in place) therefore take a bounded time
+ * which does not depend on the number or layout of the blocks.
+ *
+ * Each block has an 8-byte header, and the allocated memory is aligned to 8 bytes.
+ *
+ * `Tlsf` does not own the region nor the free list tables, which are provided by the caller. `StaticTlsf` can be used
+ * to define an allocator along with its region and tables.
+ *
+ * @note `Tlsf` is not thread-safe.
+ */
+class Tlsf : private NonCopyable
+{
+public:
+    struct Block;
+
+    static constexpr uint8_t kSlCountLog2 = 4;                 ///< Log2 of the number of second-level lists.
+    static constexpr uint8_t kSlCount     = 1 << kSlCountLog2; ///< Number of second-level lists per first level.
+
+    /**
+     * Represents the statistics of the allocator.
+     */
+    struct Stats
+    {
+        size_t   mTotalSize;       ///< Total size available for allocations (when all the memory is free).
+        size_t   mFreeSize;        ///< Total size of the free blocks.
+        size_t   mUsedSize;        ///< Total size of the allocated blocks (sizes are rounded up to 8 bytes).
+        size_t   mMaxUsedSize;     ///< Maximum `mUsedSize` since the allocator was initialized (high-water mark).
+        size_t   mLargestFreeSize; ///< Largest size that can be allocated (may be less than the largest free block).
+        uint32_t mNumFreeBlocks;   ///< Number of free blocks.
+        uint32_t mNumUsedBlocks;   ///< Number of allocated blocks.
+        uint8_t  mFragmentation;   ///< Fragmentation (in percent): the part of the free size not in the largest block.
+    };
+
+    /**
+     * Returns the number of first-level lists needed for a region of a given size.
+     *
+     * @param[in] aRegionSize  The size of the region (in bytes).
+     *
+     * @returns The number of first-level lists.
+     */
+    static constexpr uint8_t GetFlCount(size_t aRegionSize)
+    {
+        uint8_t log2 = 0;
+
+        while ((aRegionSize >> log2) > 1)
+        {
+            log2++;
+        }
+
+        return (log2 < kFlShift) ? 1 : static_cast<uint8_t>(log2 - kFlShift + 2);
+    }
+
+    /**
+     * Returns the region size needed to allocate a number of blocks of a given size at the same time.
+     *
+     * The size accounts for the header of each block and for the rounding of the sizes by the allocator, but neither
+     * for the region overhead (two block headers) nor for the fragmentation caused by other allocations.
+     *
+     * @param[in] aNumBlocks  The number of blocks.
+     * @param[in] aSize       The size of each block (in bytes).
+     *
+     * @returns The region size (in bytes).
+     */
+    static constexpr size_t GetRegionSizeFor(size_t aNumBlocks, size_t aSize)
+    {
+        size_t  size = (aSize + kAlignSize - 1) & ~static_cast<size_t>(kAlignSize - 1);
+        uint8_t log2 = 0;
+
+        size = (size < kMinPayloadSize) ? kMinPayloadSize : size;
+
+        while ((size >> log2) > 1)
+        {
+            log2++;
+        }
+
+        // The last block is found in a list of blocks at least one
+        // second-level range larger than its size.
+        return aNumBlocks * (kBlockHeaderSize + size) +
+               ((size < kSmallBlockSize) ? 0 : (static_cast<size_t>(1) << (log2 - kSlCountLog2)));
+    }
+
+    /**
+     * Initializes the allocator with all the memory of a given region free.
+     *
+     * The region start and size are aligned to 8 bytes. If the region is larger than what the free list tables can
+     * hold (see `GetFlCount()`), only the first part of it is used.
+     *
+     * @param[in] aFreeLists   A pointer to the free list table (`aFlCount * kSlCount` entries).
+     * @param[in] aSlBitmaps   A pointer to the second-level bitmap table (`aFlCount` entries).
+     * @param[in] aFlCount     The number of first-level lists (at most 32).
+     * @param[in] aRegion      A pointer to the memory region.
+     * @param[in] aRegionSize  The size of @p aRegion (in bytes).
+     */
+    Tlsf(Block **aFreeLists, uint32_t *aSlBitmaps, uint8_t aFlCount, void *aRegion, size_t aRegionSize);
+
+    /**
+     * Allocates memory.
+     *
+     * @param[in] aSize  The size to allocate (in bytes).
+     *
+     * @returns A pointer to the allocated memory, or `nullptr` if @p aSize is zero or there is no free block large
+     *          enough.
+     */
+    void *Allocate(size_t aSize);
+
+    /**
+     * Allocates memory for an array of objects, with all bytes set to zero.
+     *
+     * @param[in] aCount  The number of objects.
+     * @param[in] aSize   The size of each object (in bytes).
+     *
+     * @returns A pointer to the allocated memory, or `nullptr` if the total size is zero (or overflows) or there is no
+     *          free block large enough.
+     */
+    void *CAlloc(size_t aCount, size_t aSize);
+
+    /**
+     * Changes the size of allocated memory, keeping its content.
+     *
+     * The memory is shrunk or grown in place when possible (the latter when it is followed by a large enough free
+     * block), otherwise it is moved to a newly allocated block.
+     *
+     * @param[in] aPointer  A pointer to the allocated memory, or `nullptr` (to allocate new memory).
+     * @param[in] aSize     The new size (in bytes), or zero (to free the memory).
+     *
+     * @returns A pointer to the reallocated memory, or `nullptr` if @p aSize is zero or there is no free block large
+     *          enough (@p aPointer is then unchanged).
+     */
+    void *Reallocate(void *aPointer, size_t aSize);
+
+    /**
+     * Frees allocated memory.
+     *
+     * @param[in] aPointer  A pointer to the allocated memory, or `nullptr` (ignored).
+     */
+    void Free(void *aPointer);
+
+    /**
+     * Returns the size of allocated memory (the requested size rounded up by the allocator).
+     *
+     * @param[in] aPointer  A pointer to the allocated memory.
+     *
+     * @returns The size of the allocated memory (in bytes).
+     */
+    static size_t GetAllocatedSize(const void *aPointer);
+
+    /**
+     * Gets the statistics of the allocator.
+     *
+     * The time taken depends on the number of free blocks in the list of the largest free blocks (to find the largest
+     * one), unlike the other operations.
+     *
+     * @param[out] aStats  A reference to output the statistics.
+     */
+    void GetStats(Stats &aStats) const;
+
+private:
+    static constexpr uint8_t  kAlignSizeLog2   = 3;
+    static constexpr uint8_t  kFlShift         = kSlCountLog2 + kAlignSizeLog2;
+    static constexpr uint32_t kSmallBlockSize  = 1 << kFlShift;
+    static constexpr uint32_t kAlignSize       = 1 << kAlignSizeLog2;
+    static constexpr uint32_t kBlockHeaderSize = 2 * sizeof(uint32_t);
+    static constexpr uint32_t kMinPayloadSize  = (2 * sizeof(void *) + kAlignSize - 1) & ~(kAlignSize - 1);
+
+    static uint32_t AlignUp(uint32_t aSize) { return (aSize + kAlignSize - 1) & ~(kAlignSize - 1); }
+    static uint32_t GetMaxAllocateSize(uint32_t aBlockSize);
+    static void     MapSize(uint32_t aSize, uint8_t &aFl, uint8_t &aSl);
+    static bool     AdjustSize(size_t aSize, uint32_t &aAdjustedSize);
+
+    Block *&GetFreeList(uint8_t aFl, uint8_t aSl) const { return mFreeLists[aFl * kSlCount + aSl]; }
+    Block  *FindFreeBlock(uint32_t aSize);
+    void    InsertFreeBlock(Block &aBlock);
+    void    RemoveFreeBlock(Block &aBlock);
+    void    MarkUsed(Block &aBlock);
+    void    MarkFree(Block &aBlock);
+    void    SplitUsedBlock(Block &aBlock, uint32_t aSize);
+
+    Block   **mFreeLists;
+    uint32_t *mSlBitmaps;
+    uint32_t  mFlBitmap;
+    uint8_t   mFlCount;
+    uint32_t  mTotalSize;
+    uint32_t  mFreeSize;
+    uint32_t  mUsedSize;
+    uint32_t  mMaxUsedSize;
+    uint32_t  mNumFreeBlocks;
+    uint32_t  mNumUsedBlocks;
+};
+
+/**
+ * Defines a `Tlsf` allocator along with its memory region and free list tables.
+ *
+ * @tparam kRegionSize  The size of the memory region (in bytes).
+ */
+template <size_t kRegionSize> class StaticTlsf : public Tlsf
+{
+    static_assert(kRegionSize <= 0x80000000, "StaticTlsf region is too large");
+
+public:
+    /**
+     * Initializes the allocator with all the memory free.
+     */
+    StaticTlsf(void)
+        : Tlsf(&mFreeLists[0][0], mSlBitmaps, kFlCount, mRegion, kRegionSize)
+    {
+    }
+
+private:
+    static constexpr uint8_t kFlCount = GetFlCount(kRegionSize);
+
+    Block                    *mFreeLists[kFlCount][kSlCount];
+    uint32_t                  mSlBitmaps[kFlCount];
+    alignas(uint64_t) uint8_t mRegion[kRegionSize];
+};
+
+} // namespace ty
+
+#endif // TLSF_HPP_
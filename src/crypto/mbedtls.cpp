@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file implements the mbedTLS management.
+ */
+
+#include "mbedtls.hpp"
+
+#if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+
+#include <string.h>
+
+#include <mbedtls/platform.h>
+
+#include "common/heap.hpp"
+#include "ty/common/code_utils.hpp"
+#include "ty/common/debug.hpp"
+#include "ty/common/num_utils.hpp"
+#include "ty/common/numeric_limits.hpp"
+
+#if TY_CONFIG_MBEDTLS_HEAP_ENABLE
+#include "common/tlsf.hpp"
+#include "ty/common/object_pool.hpp"
+#endif
+
+#if !defined(MBEDTLS_PLATFORM_MEMORY)
+#error "TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT requires MBEDTLS_PLATFORM_MEMORY in the mbedTLS config"
+#endif
+
+namespace ty {
+
+MbedTls::MbedTls(void) { mbedtls_platform_set_calloc_free(CAlloc, Free); }
+
+#if TY_CONFIG_MBEDTLS_HEAP_ENABLE
+
+static constexpr size_t   kSmallBlockSize = TY_CONFIG_MBEDTLS_HEAP_SMALL_BLOCK_SIZE;
+static constexpr uint16_t kNumSmallBlocks = TY_CONFIG_MBEDTLS_HEAP_NUM_SMALL_BLOCKS;
+static constexpr size_t   kTlsfSize       = TY_CONFIG_MBEDTLS_HEAP_SIZE - kSmallBlockSize * kNumSmallBlocks;
+
+static_assert(kSmallBlockSize % sizeof(uint64_t) == 0,
+              "TY_CONFIG_MBEDTLS_HEAP_SMALL_BLOCK_SIZE must be a multiple of 8");
+static_assert(TY_CONFIG_MBEDTLS_HEAP_SIZE > kSmallBlockSize * kNumSmallBlocks,
+              "TY_CONFIG_MBEDTLS_HEAP_SIZE is too small for the small blocks");
+
+struct SmallBlock
+{
+    // Not zeroed when allocated (see `MbedTls::CAlloc()`).
+    SmallBlock(void) {}
+
+    uint64_t mWords[kSmallBlockSize / sizeof(uint64_t)];
+};
+
+class MbedTlsHeap : private NonCopyable
+{
+public:
+    MbedTlsHeap(void)
+        : mNumHandshakes(0)
+        , mHandshakeStartBytes(0)
+        , mHandshakePeakBytes(0)
+        , mMaxHandshakeBytes(0)
+    {
+    }
+
+    // The following methods MUST be called while holding the heap lock.
+
+    void *Allocate(size_t aCount, size_t aSize);
+    void  Free(void *aPointer);
+    void  ResetPeaks(void);
+    void  StartHandshake(void);
+
+    uint32_t FinishHandshake(void);
+    uint32_t GetMaxHandshakeBytes(void) const { return mMaxHandshakeBytes; }
+
+    const MemoryCounters &GetCounters(void) const { return mCounters; }
+
+private:
+    void RecordAllocation(size_t aSize, const void *aPointer, size_t aBytes);
+
+    StaticTlsf<kTlsfSize> mTlsf;
+#if TY_CONFIG_MBEDTLS_HEAP_NUM_SMALL_BLOCKS > 0
+    ObjectPool<SmallBlock, kNumSmallBlocks> mSmallBlocks;
+#endif
+    MemoryCounters mCounters;
+    uint16_t       mNumHandshakes;
+    uint32_t       mHandshakeStartBytes;
+    uint32_t       mHandshakePeakBytes;
+    uint32_t       mMaxHandshakeBytes;
+};
+
+void *MbedTlsHeap::Allocate(size_t aCount, size_t aSize)
+{
+    void  *pointer = nullptr;
+    size_t bytes   = 0;
+
+    VerifyOrExit((aSize == 0) || (aCount <= NumericLimits<size_t>::kMax / aSize));
+
+#if TY_CONFIG_MBEDTLS_HEAP_NUM_SMALL_BLOCKS > 0
+    if (aCount * aSize <= kSmallBlockSize)
+    {
+        pointer = mSmallBlocks.Allocate();
+        bytes   = kSmallBlockSize;
+    }
+#endif
+
+    if (pointer == nullptr)
+    {
+        pointer = mTlsf.Allocate(aCount * aSize);
+        bytes   = (pointer != nullptr) ? Tlsf::GetAllocatedSize(pointer) : 0;
+    }
+
+exit:
+    RecordAllocation(aCount * aSize, pointer, bytes);
+    return pointer;
+}
+
+void MbedTlsHeap::Free(void *aPointer)
+{
+    size_t bytes;
+
+    VerifyOrExit(aPointer != nullptr);
+
+#if TY_CONFIG_MBEDTLS_HEAP_NUM_SMALL_BLOCKS > 0
+    if (mSmallBlocks.Contains(*static_cast<SmallBlock *>(aPointer)))
+    {
+        mSmallBlocks.Free(static_cast<SmallBlock *>(aPointer));
+        mCounters.RecordFree(kSmallBlockSize);
+        ExitNow();
+    }
+#endif
+
+    bytes = Tlsf::GetAllocatedSize(aPointer);
+    mTlsf.Free(aPointer);
+    mCounters.RecordFree(static_cast<uint32_t>(bytes));
+
+exit:
+    return;
+}
+
+void MbedTlsHeap::RecordAllocation(size_t aSize, const void *aPointer, size_t aBytes)
+{
+    VerifyOrExit(aPointer != nullptr, mCounters.RecordFailure());
+
+    mCounters.RecordAllocation(static_cast<uint32_t>(aSize), static_cast<uint32_t>(aBytes));
+
+    if (mNumHandshakes > 0)
+    {
+        mHandshakePeakBytes = Max(mHandshakePeakBytes, mCounters.GetCurrentBytes());
+    }
+
+exit:
+    return;
+}
+
+void MbedTlsHeap::ResetPeaks(void)
+{
+    mCounters.ResetPeak();
+    mMaxHandshakeBytes = 0;
+}
+
+void MbedTlsHeap::StartHandshake(void)
+{
+    if (mNumHandshakes++ == 0)
+    {
+        mHandshakeStartBytes = mCounters.GetCurrentBytes();
+        mHandshakePeakBytes  = mHandshakeStartBytes;
+    }
+}
+
+uint32_t MbedTlsHeap::FinishHandshake(void)
+{
+    uint32_t bytes = mHandshakePeakBytes - mHandshakeStartBytes;
+
+    TY_ASSERT(mNumHandshakes > 0);
+
+    mNumHandshakes--;
+    mMaxHandshakeBytes = Max(mMaxHandshakeBytes, bytes);
+
+    return bytes;
+}
+
+static MbedTlsHeap &GetHeap(void)
+{
+    static MbedTlsHeap sHeap;
+
+    return sHeap;
+}
+
+void *MbedTls::CAlloc(size_t aCount, size_t aSize)
+{
+    void *pointer;
+
+    {
+        Heap::Lock lock;
+
+        pointer = GetHeap().Allocate(aCount, aSize);
+    }
+
+    // The memory is zeroed after releasing the lock, which may be a
+    // critical section (see `tyPlatHeapLock()`).
+
+    if (pointer != nullptr)
+    {
+        memset(pointer, 0, aCount * aSize);
+    }
+
+    return pointer;
+}
+
+void MbedTls::Free(void *aPointer)
+{
+    Heap::Lock lock;
+
+    GetHeap().Free(aPointer);
+}
+
+void MbedTls::GetStats(MemoryStats &aStats)
+{
+    Heap::Lock lock;
+
+    GetHeap().GetCounters().GetStats(aStats);
+    aStats.mCapacityBytes = static_cast<uint32_t>(TY_CONFIG_MBEDTLS_HEAP_SIZE);
+}
+
+void MbedTls::ResetPeaks(void)
+{
+    Heap::Lock lock;
+
+    GetHeap().ResetPeaks();
+}
+
+void MbedTls::StartHandshake(void)
+{
+    Heap::Lock lock;
+
+    GetHeap().StartHandshake();
+}
+
+uint32_t MbedTls::FinishHandshake(void)
+{
+    Heap::Lock lock;
+
+    return GetHeap().FinishHandshake();
+}
+
+uint32_t MbedTls::GetMaxHandshakeBytes(void)
+{
+    Heap::Lock lock;
+
+    return GetHeap().GetMaxHandshakeBytes();
+}
+
+#else // TY_CONFIG_MBEDTLS_HEAP_ENABLE
+
+void *MbedTls::CAlloc(size_t aCount, size_t aSize) { return Heap::CAlloc(aCount, aSize, kMemoryTagMbedTls); }
+
+void MbedTls::Free(void *aPointer) { Heap::Free(aPointer, kMemoryTagMbedTls); }
+
+void MbedTls::GetStats(MemoryStats &aStats) { Heap::GetCounters(kMemoryTagMbedTls).GetStats(aStats); }
+
+void MbedTls::ResetPeaks(void) {}
+
+void MbedTls::StartHandshake(void) {}
+
+uint32_t MbedTls::FinishHandshake(void) { return 0; }
+
+uint32_t MbedTls::GetMaxHandshakeBytes(void) { return 0; }
+
+#endif // TY_CONFIG_MBEDTLS_HEAP_ENABLE
+
+} // namespace ty
+
+#endif // TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ *   This file includes definitions for the mbedTLS management.
+ */
+
+#ifndef MBEDTLS_HPP_
+#define MBEDTLS_HPP_
+
+#include "ty/ty-core-config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/memory_stats.hpp"
+#include "ty/common/non_copyable.hpp"
+
+#if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+
+namespace ty {
+
+/**
+ * Manages the mbedTLS memory allocations.
+ *
+ * When constructed, installs the mbedTLS memory hooks (`mbedtls_platform_set_calloc_free()`) so that mbedTLS
+ * allocates from a dedicated internal heap region of `TY_CONFIG_MBEDTLS_HEAP_SIZE` bytes. The short-lived handshake
+ * allocations then cannot fragment the heap, and their usage is accounted separately. Allocations of up to
+ * `TY_CONFIG_MBEDTLS_HEAP_SMALL_BLOCK_SIZE` bytes (e.g., big number limbs) are served from a pool of fixed-size blocks
+ * taken from the region, and only fall back to the TLSF allocator when the pool is exhausted.
+ *
+ * If `TY_CONFIG_MBEDTLS_HEAP_ENABLE` is not set, mbedTLS allocates from the `Heap` with `kMemoryTagMbedTls`, and the
+ * handshake usage is not accounted.
+ *
+ * The region is protected by the heap lock (see `Heap::Lock`).
+ */
+class MbedTls : private NonCopyable
+{
+public:
+    /**
+     * Initializes the object and installs the mbedTLS memory hooks.
+     */
+    MbedTls(void);
+
+    /**
+     * Gets the memory usage statistics of mbedTLS.
+     *
+     * @param[out] aStats  A reference to output the statistics.
+     */
+    static void GetStats(MemoryStats &aStats);
+
+    /**
+     * Resets the high-water marks of the mbedTLS memory usage (including the maximum handshake usage).
+     */
+    static void ResetPeaks(void);
+
+    /**
+     * Starts accounting the memory used by a handshake.
+     *
+     * The handshake usage is the high-water mark of the mbedTLS memory usage while the handshake is ongoing, above
+     * the usage when it started. Concurrent handshakes are accounted together, from the start of the first one.
+     *
+     * Each call MUST be paired with a call to `FinishHandshake()`.
+     */
+    static void StartHandshake(void);
+
+    /**
+     * Finishes accounting the memory used by a handshake.
+     *
+     * @returns The number of bytes used by the handshake (zero if `TY_CONFIG_MBEDTLS_HEAP_ENABLE` is not set).
+     */
+    static uint32_t FinishHandshake(void);
+
+    /**
+     * Returns the maximum number of bytes used by a handshake (see `FinishHandshake()`).
+     *
+     * @returns The maximum number of bytes used by a handshake.
+     */
+    static uint32_t GetMaxHandshakeBytes(void);
+
+private:
+    static void *CAlloc(size_t aCount, size_t aSize);
+    static void  Free(void *aPointer);
+};
+
+} // namespace ty
+
+#endif // TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+
+#endif // MBEDTLS_HPP_
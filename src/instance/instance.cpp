@@ -32,10 +32,14 @@ void tinyInstanceFinalize(tinyInstance *aInstance)
  * C++ Implementation
  *******************************************/
 namespace ty {
-// Define the raw storage used for Tiny instance (in single-instance case).
-TY_DEFINE_ALIGNED_VAR(gInstanceRaw, sizeof(Instance), uint64_t);
+// Define the raw storage used for Tiny instance (in single-instance case),
+// aligned as the instance since some members are cache line aligned.
+alignas(Instance) TY_DEFINE_ALIGNED_VAR(gInstanceRaw, sizeof(Instance), uint64_t);
 
-Instance::Instance(void) {}
+Instance::Instance(void)
+    : mMemoryAccounting(mMessagePool)
+{
+}
 
 Instance &Instance::InitSingle(void)
 {
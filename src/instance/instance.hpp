@@ -8,6 +8,10 @@
 #include <ty/common/as_core_type.hpp>
 #include <ty/common/non_copyable.hpp>
 
+#include "common/memory_stats.hpp"
+#include "common/message_pool.hpp"
+#include "crypto/mbedtls.hpp"
+
 typedef struct tinyInstance
 {
 } tinyInstance;
@@ -95,7 +99,12 @@ private:
 #if TY_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
     static LogLevel sLogLevel;
 #endif
-    bool mIsInitialized;
+    bool             mIsInitialized;
+#if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+    MbedTls          mMbedTls;
+#endif
+    MessagePool      mMessagePool;
+    MemoryAccounting mMemoryAccounting;
 };
 
 DefineCoreType(tinyInstance, Instance);
@@ -104,6 +113,23 @@ template <> inline Instance &Instance::Get(void)
 {
     return *this;
 }
+
+#if TY_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+template <> inline MbedTls &Instance::Get(void)
+{
+    return mMbedTls;
+}
+#endif
+
+template <> inline MessagePool &Instance::Get(void)
+{
+    return mMessagePool;
+}
+
+template <> inline MemoryAccounting &Instance::Get(void)
+{
+    return mMemoryAccounting;
+}
 } // namespace ty
 
 #endif // INSTANCE_H_
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief
+ *   This file includes platform abstractions for dynamic memory allocation.
+ */
+
+#include "ty/ty-core-config.h"
+
+#include "ty/platform/memory.h"
+
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+
+// The heap operations are short and bounded in time, so a critical
+// section (a spin lock across the cores) is used instead of a mutex.
+static portMUX_TYPE sHeapMux = portMUX_INITIALIZER_UNLOCKED;
+
+void *tyPlatCAlloc(size_t aNum, size_t aSize)
+{
+    return calloc(aNum, aSize);
+}
+
+void *tyPlatRealloc(void *aPtr, size_t aSize)
+{
+    return realloc(aPtr, aSize);
+}
+
+void tyPlatFree(void *aPtr)
+{
+    free(aPtr);
+}
+
+void tyPlatHeapLock(void)
+{
+    portENTER_CRITICAL(&sHeapMux);
+}
+
+void tyPlatHeapUnlock(void)
+{
+    portEXIT_CRITICAL(&sHeapMux);
+}
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief
+ *   This file includes platform abstractions for dynamic memory allocation.
+ */
+
+#include "ty/ty-core-config.h"
+
+#include "ty/platform/memory.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+static pthread_mutex_t sHeapMutex = PTHREAD_MUTEX_INITIALIZER;
+
+void *tyPlatCAlloc(size_t aNum, size_t aSize)
+{
+    return calloc(aNum, aSize);
+}
+
+void *tyPlatRealloc(void *aPtr, size_t aSize)
+{
+    return realloc(aPtr, aSize);
+}
+
+void tyPlatFree(void *aPtr)
+{
+    free(aPtr);
+}
+
+void tyPlatHeapLock(void)
+{
+    pthread_mutex_lock(&sHeapMutex);
+}
+
+void tyPlatHeapUnlock(void)
+{
+    pthread_mutex_unlock(&sHeapMutex);
+}
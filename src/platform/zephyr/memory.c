@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright 2025 Clever Design (Switzerland) GmbH
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief
+ *   This file includes platform abstractions for dynamic memory allocation.
+ */
+
+#include "ty/ty-core-config.h"
+
+#include "ty/platform/memory.h"
+
+#include "zephyr/kernel.h"
+
+static K_MUTEX_DEFINE(sHeapMutex);
+
+void *tyPlatCAlloc(size_t aNum, size_t aSize)
+{
+    return k_calloc(aNum, aSize);
+}
+
+void *tyPlatRealloc(void *aPtr, size_t aSize)
+{
+    return k_realloc(aPtr, aSize);
+}
+
+void tyPlatFree(void *aPtr)
+{
+    k_free(aPtr);
+}
+
+void tyPlatHeapLock(void)
+{
+    k_mutex_lock(&sHeapMutex, K_FOREVER);
+}
+
+void tyPlatHeapUnlock(void)
+{
+    k_mutex_unlock(&sHeapMutex);
+}